@@ -31,4 +31,7 @@ enum class CategoryEnum {
     Unspecified
 };
 
+/** Number of CategoryEnum values, including Unspecified */
+constexpr int CategoryCount = static_cast<int>(CategoryEnum::Unspecified) + 1;
+
 #endif // CATEGORYENUM_H
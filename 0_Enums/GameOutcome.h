@@ -0,0 +1,29 @@
+#ifndef GAMEOUTCOME_H
+#define GAMEOUTCOME_H
+
+/**
+ * @enum GameOutcome
+ * @brief How a game session ended.
+ *
+ * Stored with every session in the game history. The values are written
+ * to disk, so new outcomes must be appended.
+ */
+enum class GameOutcome {
+
+    /** The word was guessed */
+    Won,
+
+    /** No incorrect guesses were left */
+    Lost,
+
+    /** The time limit was reached */
+    TimedOut,
+
+    /** The player left before the game was over */
+    Abandoned
+};
+
+/** Number of GameOutcome values */
+constexpr int GameOutcomeCount = static_cast<int>(GameOutcome::Abandoned) + 1;
+
+#endif // GAMEOUTCOME_H
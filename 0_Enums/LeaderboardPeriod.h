@@ -0,0 +1,22 @@
+#ifndef LEADERBOARDPERIOD_H
+#define LEADERBOARDPERIOD_H
+
+/**
+ * @enum LeaderboardPeriod
+ * @brief Time span a leaderboard covers.
+ *
+ * Used by HighScoreManager to select which ranked index to read.
+ */
+enum class LeaderboardPeriod {
+
+    /** Points earned today */
+    Daily,
+
+    /** Points earned during the last seven days, today included */
+    Weekly,
+
+    /** Every point ever earned */
+    AllTime
+};
+
+#endif // LEADERBOARDPERIOD_H
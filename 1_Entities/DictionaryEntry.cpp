@@ -0,0 +1,103 @@
+#include "1_Entities/DictionaryEntry.h"
+#include <cctype>
+#include <string_view>
+
+using namespace std;
+
+/**
+ * @brief Constructs a dictionary entry and computes its letter mask.
+ * 
+ * @param id Position of the entry in its repository.
+ * @param word The word; must stay valid for the entry's lifetime.
+ * @param category The category of the word.
+ */
+DictionaryEntry::DictionaryEntry(uint32_t id, string_view word, CategoryEnum category)
+    : id(id), category(category), letterMask(0), word(word) {
+    for (char c : this->word) {
+        letterMask |= letterBit(c);
+    }
+}
+
+/**
+ * @brief Constructs a dictionary entry with a precomputed letter mask.
+ * 
+ * Used when the mask is already stored alongside the word, e.g. in a
+ * compiled dictionary image.
+ * 
+ * @param id Position of the entry in its repository.
+ * @param word The word; must stay valid for the entry's lifetime.
+ * @param category The category of the word.
+ * @param letterMask Mask of the distinct letters in the word.
+ */
+DictionaryEntry::DictionaryEntry(uint32_t id, string_view word, CategoryEnum category, uint32_t letterMask)
+    : id(id), category(category), letterMask(letterMask), word(word) {}
+
+/**
+ * @brief Returns the ID of the entry.
+ * 
+ * @return The entry ID.
+ */
+uint32_t DictionaryEntry::getId() const {
+    return id;
+}
+
+/**
+ * @brief Returns the word.
+ * 
+ * @return View of the word in the repository's string arena.
+ */
+string_view DictionaryEntry::getWord() const {
+    return word;
+}
+
+/**
+ * @brief Converts the word to a QString.
+ * 
+ * Nothing is cached on the entry, so callers that need the text more
+ * than once should keep the result (see GuessSession::getWordText()).
+ * 
+ * @return A new QString holding the word.
+ */
+QString DictionaryEntry::toQString() const {
+    return QString::fromUtf8(word.data(), static_cast<int>(word.size()));
+}
+
+/**
+ * @brief Returns the category of the word.
+ * 
+ * @return CategoryEnum value representing the word category.
+ */
+CategoryEnum DictionaryEntry::getCategory() const {
+    return category;
+}
+
+/**
+ * @brief Returns the mask of letters contained in the word.
+ * 
+ * @return Letter mask (bit 0 = 'a' ... bit 25 = 'z').
+ */
+uint32_t DictionaryEntry::getLetterMask() const {
+    return letterMask;
+}
+
+/**
+ * @brief Maps a character to its bit in a letter mask.
+ * 
+ * @param letter The character to map (case-insensitive).
+ * @return The letter's bit, or 0 if the character is not a letter.
+ */
+uint32_t DictionaryEntry::letterBit(char letter) {
+    unsigned char c = static_cast<unsigned char>(tolower(static_cast<unsigned char>(letter)));
+    if (c < 'a' || c > 'z') return 0;
+    return 1u << (c - 'a');
+}
+
+/**
+ * @brief Maps a letter to its alphabet index.
+ * 
+ * @param letter The letter to map (case-insensitive, must be a-z).
+ * @return Index between 0 and 25.
+ */
+int DictionaryEntry::letterIndex(char letter) {
+    return tolower(static_cast<unsigned char>(letter)) - 'a';
+}
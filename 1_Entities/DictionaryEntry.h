@@ -0,0 +1,107 @@
+#ifndef DICTIONARYENTRY_H
+#define DICTIONARYENTRY_H
+
+#include <string_view>
+#include <cstdint>
+#include <QString>
+#include "0_Enums/CategoryEnum.h"
+
+/**
+ * @class DictionaryEntry
+ * @brief Immutable dictionary data for a single word.
+ * 
+ * An entry holds only what never changes during play: its ID, the word,
+ * its category and the mask of letters it contains. Guess progress lives
+ * in GuessSession, so one entry can back any number of games at once.
+ * 
+ * The word text is not owned by the entry: it is a view into the
+ * repository's string arena. No QString is kept per entry; the text is
+ * converted only when a word is drawn or saved.
+ */
+class DictionaryEntry {
+private:
+    /** Position of the entry in its repository */
+    uint32_t id;
+
+    /** Category of the word */
+    CategoryEnum category;
+
+    /** Mask of the distinct letters that appear in the word */
+    uint32_t letterMask;
+
+    /** The word itself, stored in the repository's string arena */
+    std::string_view word;
+
+public:
+    /**
+     * @brief Constructs a dictionary entry.
+     * 
+     * @param id Position of the entry in its repository.
+     * @param word The word; must stay valid for the entry's lifetime.
+     * @param category The category of the word.
+     */
+    DictionaryEntry(uint32_t id, std::string_view word, CategoryEnum category);
+
+    /**
+     * @brief Constructs a dictionary entry with a precomputed letter mask.
+     * 
+     * @param id Position of the entry in its repository.
+     * @param word The word; must stay valid for the entry's lifetime.
+     * @param category The category of the word.
+     * @param letterMask Mask of the distinct letters in the word.
+     */
+    DictionaryEntry(uint32_t id, std::string_view word, CategoryEnum category, uint32_t letterMask);
+
+    /**
+     * @brief Returns the ID of the entry.
+     * 
+     * @return The entry ID.
+     */
+    uint32_t getId() const;
+
+    /**
+     * @brief Returns the word.
+     * 
+     * @return View of the word in the repository's string arena.
+     */
+    std::string_view getWord() const;
+
+    /**
+     * @brief Converts the word to a QString.
+     * 
+     * @return A new QString holding the word.
+     */
+    QString toQString() const;
+
+    /**
+     * @brief Returns the category of the word.
+     * 
+     * @return The word category.
+     */
+    CategoryEnum getCategory() const;
+
+    /**
+     * @brief Returns the mask of letters contained in the word.
+     * 
+     * @return Letter mask (bit 0 = 'a' ... bit 25 = 'z').
+     */
+    uint32_t getLetterMask() const;
+
+    /**
+     * @brief Maps a character to its bit in a letter mask.
+     * 
+     * @param letter The character to map (case-insensitive).
+     * @return The letter's bit, or 0 if the character is not a letter.
+     */
+    static uint32_t letterBit(char letter);
+
+    /**
+     * @brief Maps a letter to its alphabet index.
+     * 
+     * @param letter The letter to map (case-insensitive, must be a-z).
+     * @return Index between 0 and 25.
+     */
+    static int letterIndex(char letter);
+};
+
+#endif // DICTIONARYENTRY_H
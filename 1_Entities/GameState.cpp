@@ -9,13 +9,13 @@
 
 /**
  * @brief Constructor for the GameState class.
- * @param word Pointer to the Word object to be guessed in the game.
+ * @param session Pointer to the guess session for the word in the game.
  * @param maxSeconds The maximum time allowed for the game session in seconds.
  */
  
 
-GameState::GameState(Word* word, int maxSeconds)
-    : m_currentWord(word),
+GameState::GameState(GuessSession* session, int maxSeconds)
+    : m_currentSession(session),
       m_maxTimeSeconds(maxSeconds),
       m_remainingGuesses(6) 
 {
@@ -49,12 +49,12 @@ int GameState::getElapsedTime() const {
 }
 /**
  * @brief Retrieves the string representation of the word currently being guessed.
- * @return A QString containing the current word's text.
+ * @return A QString containing the current word's text, shared with the guess session's copy.
  */
 
 QString GameState::getCurrentWordDisplayText() const {
-    if (!m_currentWord) return "";
-    return QString::fromStdString(m_currentWord->getWord());
+    if (!m_currentSession) return "";
+    return m_currentSession->getWordText();
 }
     
    /**
@@ -73,8 +73,8 @@ void GameState::decreaseRemainingGuesses() {
     */
     
 bool GameState::isGameWon() const {
-    if (!m_currentWord) return false;
-    return m_currentWord->isGuessed();
+    if (!m_currentSession) return false;
+    return m_currentSession->isGuessed();
 }
     /**
 	 * @brief Evaluates all termination conditions (win, out of guesses, or timeout).
@@ -95,10 +95,26 @@ bool GameState::isGameOver() const {
     return false;
 }
 
-/** * @brief Gets the pointer to the current word object.
- * @return Word* pointer. 
+/**
+ * @brief Tells how the game ended.
+ * @return Won, Lost or TimedOut once the game is over, Abandoned while it is still running.
+ */
+GameOutcome GameState::getOutcome() const {
+    if (isGameWon()) return GameOutcome::Won;
+    if (m_remainingGuesses <= 0) return GameOutcome::Lost;
+    if (m_maxTimeSeconds > 0 && getElapsedTime() >= m_maxTimeSeconds) return GameOutcome::TimedOut;
+    return GameOutcome::Abandoned;
+}
+
+/** * @brief Gets the time at which the game started.
+ * @return Start time, or a null QDateTime if the timer was never started.
+ */
+QDateTime GameState::getStartTime() const { return m_dateTimeStart; }
+
+/** * @brief Gets the pointer to the current guess session.
+ * @return GuessSession* pointer. 
  */
-Word* GameState::getCurrentWord() const { return m_currentWord; }
+GuessSession* GameState::getCurrentSession() const { return m_currentSession; }
 /** * @brief Gets the number of incorrect guesses the player has left.
  * @return Remaining guesses count. 
  */
@@ -10,7 +10,8 @@
 
 #include <QDateTime> 
 #include <QString>
-#include "1_Entities/Word.h"
+#include "0_Enums/GameOutcome.h"
+#include "1_Entities/GuessSession.h"
 
 /**
  * @class GameState
@@ -22,10 +23,10 @@ class GameState {
 public:
     /**
 	     * @brief Constructs a new GameState object.
-	     * @param word Pointer to the target Word object.
+	     * @param session Pointer to the guess session for the target word.
 	     * @param maxSeconds Maximum duration allowed for the game in seconds.
 	     */
-    GameState(Word* word, int maxSeconds);
+    GameState(GuessSession* session, int maxSeconds);
 
     /** @brief Starts the session timer. */
     void startTimer();
@@ -58,9 +59,18 @@ public:
 	  * @return true if the game is over, false if it is still active.
 	  */
     bool isGameOver() const; 
+
+    /**
+     * @brief Tells how the game ended.
+     * @return Won, Lost or TimedOut once the game is over, Abandoned while it is still running.
+     */
+    GameOutcome getOutcome() const;
+
+    /** @return Time at which the timer was started; null if it never was. */
+    QDateTime getStartTime() const;
     
-    /** @return Pointer to the current Word object. */   
-    Word* getCurrentWord() const;
+    /** @return Pointer to the current GuessSession object. */   
+    GuessSession* getCurrentSession() const;
     
     /** @return Number of remaining incorrect guesses allowed. */
     int getRemainingGuesses() const;
@@ -70,7 +80,7 @@ public:
         
 
 private:
-    Word* m_currentWord;  ///< Pointer to the word being guessed.
+    GuessSession* m_currentSession;  ///< Guess session for the word being guessed.
 	int m_maxTimeSeconds;  ///< Total time limit in seconds.
     int m_remainingGuesses; ///< Number of lives/guesses remaining.
     QDateTime m_dateTimeStart;  ///< Timestamp for when the game started.
@@ -0,0 +1,220 @@
+#include "1_Entities/GuessSession.h"
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <string_view>
+
+#include "0_Enums/CategoryEnum.h"
+
+using namespace std;
+
+/**
+ * @brief Starts a guess session for a dictionary entry.
+ * 
+ * Builds the letter-to-positions index, the masked buffers and the
+ * word's QString once.
+ * 
+ * @param entry The entry to be guessed. It must outlive the session.
+ */
+GuessSession::GuessSession(const DictionaryEntry& entry)
+    : entryId(entry.getId()), entry(&entry), incorrectGuesses(0), guessCount(0), guessed(false),
+      guessedMask(0), revealedCount(0), letterStart{}, wordText(entry.toQString()) {
+    string_view word = entry.getWord();
+    const size_t length = word.size();
+    maskedWord.assign(length, '_');
+    displayText.fill(QLatin1Char(' '), length > 0 ? static_cast<int>(length * 2 - 1) : 0);
+
+    // Count occurrences of each letter; non-letters are never hidden
+    for (size_t i = 0; i < length; ++i) {
+        char c = word[i];
+        if (DictionaryEntry::letterBit(c) == 0) {
+            maskedWord[i] = c;
+            displayText[static_cast<int>(i * 2)] = QLatin1Char(c);
+            revealedCount++;
+            continue;
+        }
+        displayText[static_cast<int>(i * 2)] = QLatin1Char('_');
+        letterStart[DictionaryEntry::letterIndex(c) + 1]++;
+    }
+
+    // Turn counts into run offsets, then place each position in its run
+    for (size_t i = 1; i < letterStart.size(); ++i) {
+        letterStart[i] += letterStart[i - 1];
+    }
+    letterPositions.resize(letterStart[26]);
+    array<uint32_t, 26> next;
+    copy(letterStart.begin(), letterStart.end() - 1, next.begin());
+    for (size_t i = 0; i < length; ++i) {
+        if (DictionaryEntry::letterBit(word[i]) == 0) continue;
+        letterPositions[next[DictionaryEntry::letterIndex(word[i])]++] = static_cast<uint32_t>(i);
+    }
+}
+
+/**
+ * @brief Returns the ID of the dictionary entry being guessed.
+ * 
+ * @return The entry ID.
+ */
+uint32_t GuessSession::getEntryId() const {
+    return entryId;
+}
+
+/**
+ * @brief Returns the dictionary entry being guessed.
+ * 
+ * @return Reference to the entry.
+ */
+const DictionaryEntry& GuessSession::getEntry() const {
+    return *entry;
+}
+
+/**
+ * @brief Returns the actual word.
+ * 
+ * @return View of the word in the dictionary.
+ */
+string_view GuessSession::getWord() const {
+    return entry->getWord();
+}
+
+/**
+ * @brief Returns the word as a QString.
+ * 
+ * @return Reference to the text converted when the session started.
+ */
+const QString& GuessSession::getWordText() const {
+    return wordText;
+}
+
+/**
+ * @brief Returns the category of the word.
+ * 
+ * @return CategoryEnum value representing the word category.
+ */
+CategoryEnum GuessSession::getCategory() const {
+    return entry->getCategory();
+}
+
+/**
+ * @brief Tries to guess a letter in the word.
+ * 
+ * The letter is added to the guessed letters mask.
+ * If the letter does not exist in the word, incorrect guess count is increased.
+ * If all letters are guessed correctly, the word is marked as guessed.
+ * 
+ * @param letter The letter to guess.
+ * @return true if the letter exists in the word, false otherwise.
+ */
+bool GuessSession::guessLetter(char letter) {
+    const uint32_t letterMask = entry->getLetterMask();
+    string_view word = entry->getWord();
+    uint32_t bit = DictionaryEntry::letterBit(letter);
+    guessCount++;
+
+    if ((letterMask & bit) == 0) {
+        guessedMask |= bit;
+        incorrectGuesses++;
+        return false;
+    }
+
+    // Reveal the letter's positions only the first time it is guessed
+    if ((guessedMask & bit) == 0) {
+        guessedMask |= bit;
+        int index = DictionaryEntry::letterIndex(letter);
+        for (uint32_t i = letterStart[index]; i < letterStart[index + 1]; ++i) {
+            uint32_t pos = letterPositions[i];
+            maskedWord[pos] = word[pos];
+            displayText[static_cast<int>(pos * 2)] = QLatin1Char(word[pos]);
+        }
+        revealedCount += letterStart[index + 1] - letterStart[index];
+    }
+
+    guessed = (guessedMask & letterMask) == letterMask;
+    return true;
+}
+
+/**
+ * @brief Checks whether the word has been completely guessed.
+ * 
+ * @return true if the word is guessed, false otherwise.
+ */
+bool GuessSession::isGuessed() const {
+    return guessed;
+}
+
+/**
+ * @brief Returns the number of incorrect guesses.
+ * 
+ * @return Number of incorrect guesses.
+ */
+int GuessSession::getIncorrectGuesses() const {
+    return incorrectGuesses;
+}
+
+/**
+ * @brief Returns the number of letters guessed so far.
+ * 
+ * @return Number of guesses, correct or not.
+ */
+int GuessSession::getGuessCount() const {
+    return guessCount;
+}
+
+/**
+ * @brief Manually sets the guessed state of the word.
+ * 
+ * @param guessed Boolean value to set guessed status.
+ */
+void GuessSession::setGuessed(bool guessed) {
+    this->guessed = guessed;
+}
+
+/**
+ * @brief Checks if a specific letter has already been guessed.
+ * 
+ * @param letter The letter to check.
+ * @return true if the letter was guessed before, false otherwise.
+ */
+bool GuessSession::isLetterGuessed(char letter) const {
+    uint32_t bit = DictionaryEntry::letterBit(letter);
+    return bit != 0 && (guessedMask & bit) != 0;
+}
+
+/**
+ * @brief Calculates the completion percentage of the word.
+ * 
+ * The percentage is based on how many letters of the word
+ * have been correctly guessed. The revealed position count is
+ * maintained by guessLetter(), so no rescan is needed here.
+ * 
+ * @return Completion percentage between 0 and 100.
+ */
+double GuessSession::getCompletionPercentage() const {
+    if (maskedWord.empty()) return 0.0;
+
+    return (revealedCount * 100.0) / maskedWord.size();
+}
+
+/**
+ * @brief Returns the masked word.
+ * 
+ * The buffer is updated in place by guessLetter(), so no string is
+ * rebuilt when the masked word is requested.
+ * 
+ * @return Reference to the cached masked word.
+ */
+const string& GuessSession::getMaskedWord() const {
+    return maskedWord;
+}
+
+/**
+ * @brief Returns the masked word with a space between letters.
+ * 
+ * Kept as a QString and patched in place by guessLetter(), so the UI
+ * can show it without converting on every guess.
+ * 
+ * @return Reference to the cached display text.
+ */
+const QString& GuessSession::getDisplayText() const {
+    return displayText;
+}
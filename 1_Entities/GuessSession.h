@@ -0,0 +1,180 @@
+#ifndef GUESSSESSION_H
+#define GUESSSESSION_H
+
+#include <string>
+#include <string_view>
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <QString>
+#include "0_Enums/CategoryEnum.h"
+#include "1_Entities/DictionaryEntry.h"
+
+/**
+ * @class GuessSession
+ * @brief Tracks the progress of guessing one dictionary word letter by letter.
+ *
+ * A session refers to an immutable DictionaryEntry by ID and only stores
+ * the per-game state: guessed letters, number of incorrect guesses and
+ * completion status. The dictionary itself is never copied.
+ *
+ * Letters are tracked as 32-bit masks (bit 0 = 'a' ... bit 25 = 'z'),
+ * so win detection, completion percentage and repeated-guess checks
+ * are constant-time bit operations instead of set lookups.
+ *
+ * A letter-to-positions index is built once at construction and the
+ * masked word is kept in a cached buffer, so a guess only touches the
+ * positions it reveals. The word's QString is also built here, once per
+ * drawn word, rather than for every dictionary entry.
+ */
+class GuessSession {
+private:
+    /** ID of the dictionary entry being guessed */
+    uint32_t entryId;
+
+    /** The dictionary entry being guessed (owned by the repository) */
+    const DictionaryEntry* entry;
+
+    /** Number of incorrect letter guesses */
+    int incorrectGuesses;
+
+    /** Number of letter guesses, correct or not */
+    int guessCount;
+
+    /** Indicates whether the word has been fully guessed */
+    bool guessed;
+
+    /** Mask of the letters that have already been guessed */
+    uint32_t guessedMask;
+
+    /** Number of word positions whose letter has been revealed */
+    int revealedCount;
+
+    /**
+     * Start of each letter's run in letterPositions; the positions of
+     * letter i are [letterStart[i], letterStart[i + 1]).
+     */
+    std::array<uint32_t, 27> letterStart;
+
+    /** Word positions grouped by letter */
+    std::vector<uint32_t> letterPositions;
+
+    /** Masked word with unguessed letters replaced by underscores */
+    std::string maskedWord;
+
+    /** Masked word with a space between letters, kept as a QString for the UI */
+    QString displayText;
+
+    /** The word converted for the UI when the session started */
+    QString wordText;
+
+public:
+    /**
+     * @brief Starts a guess session for a dictionary entry.
+     *
+     * @param entry The entry to be guessed. It must outlive the session.
+     */
+    explicit GuessSession(const DictionaryEntry& entry);
+
+    /**
+     * @brief Returns the ID of the dictionary entry being guessed.
+     *
+     * @return The entry ID.
+     */
+    uint32_t getEntryId() const;
+
+    /**
+     * @brief Returns the dictionary entry being guessed.
+     *
+     * @return Reference to the entry.
+     */
+    const DictionaryEntry& getEntry() const;
+
+    /**
+     * @brief Returns the word.
+     *
+     * @return View of the word in the dictionary.
+     */
+    std::string_view getWord() const;
+
+    /**
+     * @brief Returns the word as a QString.
+     *
+     * @return Reference to the text converted when the session started.
+     */
+    const QString& getWordText() const;
+
+    /**
+     * @brief Returns the category of the word.
+     *
+     * @return The word category.
+     */
+    CategoryEnum getCategory() const;
+
+    /**
+     * @brief Attempts to guess a letter in the word.
+     *
+     * @param letter The letter to guess.
+     * @return true if the letter exists in the word, false otherwise.
+     */
+    bool guessLetter(char letter);
+
+    /**
+     * @brief Checks if the word has been completely guessed.
+     *
+     * @return true if the word is fully guessed, false otherwise.
+     */
+    bool isGuessed() const;
+
+    /**
+     * @brief Returns the number of incorrect guesses.
+     *
+     * @return Number of incorrect guesses.
+     */
+    int getIncorrectGuesses() const;
+
+    /**
+     * @brief Returns the number of letters guessed so far.
+     *
+     * @return Number of guesses, correct or not.
+     */
+    int getGuessCount() const;
+
+    /**
+     * @brief Sets the guessed state of the word.
+     *
+     * @param guessed New guessed state.
+     */
+    void setGuessed(bool guessed);
+
+    /**
+     * @brief Checks whether a letter has already been guessed.
+     *
+     * @param letter The letter to check.
+     * @return true if the letter was guessed before, false otherwise.
+     */
+    bool isLetterGuessed(char letter) const;
+
+    /**
+     * @brief Calculates the percentage of correctly guessed letters.
+     *
+     * @return Completion percentage (0–100).
+     */
+    double getCompletionPercentage() const;
+
+    /**
+     * @brief Returns the masked word (e.g. "_a_").
+     *
+     * @return Reference to the cached masked word.
+     */
+    const std::string& getMaskedWord() const;
+
+    /**
+     * @brief Returns the masked word spaced out for display (e.g. "_ a _").
+     *
+     * @return Reference to the cached display text.
+     */
+    const QString& getDisplayText() const;
+};
+
+#endif // GUESSSESSION_H
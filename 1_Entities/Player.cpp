@@ -1,5 +1,4 @@
 #include "1_Entities/Player.h"
-#include <QDebug>
 
 /**
  * @brief Constructs a Player object with a given name and level.
@@ -40,23 +39,33 @@ int Player::getScore() const {
 
 /**
  * @brief Increases player's score by 5 for a correct guess.
+ * @param category Category of the word being guessed.
  */
-void Player::increaseScoreForCorrectGuess() {
+void Player::increaseScoreForCorrectGuess(CategoryEnum category) {
+    int oldScore = score.getTotalScore();
     score.correctGuess();
+    notifyScoreChanged(oldScore);
+    notifyPointsEarned(oldScore, category);
 }
 
 /**
  * @brief Decreases player's score by 2 for an incorrect guess.
+ * @param category Category of the word being guessed.
  */
-void Player::decreaseScoreForIncorrectGuess() {
+void Player::decreaseScoreForIncorrectGuess(CategoryEnum category) {
+    int oldScore = score.getTotalScore();
     score.incorrectGuess();
+    notifyScoreChanged(oldScore);
+    notifyPointsEarned(oldScore, category);
 }
 
 /**
  * @brief Resets the player's score to zero or default state.
  */
 void Player::resetScore() {
+    int oldScore = score.getTotalScore();
     score.resetScore();
+    notifyScoreChanged(oldScore);
 }
 
 /**
@@ -64,14 +73,18 @@ void Player::resetScore() {
  * @param newLevel New PlayerLevel value.
  */
 void Player::setLevel(PlayerLevel newLevel) {
+    if (level == newLevel) return;
     level = newLevel;
+    markDirty(DirtyLevel);
 }
 /**
  * @brief Sets the player's last game duration.
  * @param seconds Playtime duration in seconds.
  */
 void Player::setLastGameTime(int seconds) {
+    if (lastGameTime == seconds) return;
     lastGameTime = seconds;
+    markDirty(DirtyLastGameTime);
 }
 
 /**
@@ -87,7 +100,67 @@ int Player::getLastGameTime() const {
  * @param savedScore Stored score value.
  */
 void Player::setScore(int savedScore) {
+    int oldScore = score.getTotalScore();
     score.setTotalScore(savedScore);
+    notifyScoreChanged(oldScore);
+}
+
+/**
+ * @brief Sets the object notified about score and data changes.
+ * @param newObserver The observer, or nullptr to detach.
+ */
+void Player::setObserver(PlayerObserver* newObserver) {
+    observer = newObserver;
+}
+
+/**
+ * @brief Flags fields as changed since the last save.
+ * @param fields DirtyField bits.
+ * Only the transition from clean to dirty is reported, so the observer
+ * hears about a player once per save cycle.
+ */
+void Player::markDirty(unsigned fields) {
+    const bool wasClean = dirtyFields == 0;
+    dirtyFields |= fields;
+    if (wasClean && dirtyFields != 0 && observer) {
+        observer->playerChanged(this);
+    }
+}
+
+/**
+ * @brief Returns the changed fields and marks the player as saved.
+ * @return DirtyField bits changed since the previous call.
+ */
+unsigned Player::takeDirtyFields() {
+    const unsigned fields = dirtyFields;
+    dirtyFields = 0;
+    return fields;
+}
+
+/**
+ * @brief Notifies the observer if the score actually changed.
+ * @param oldScore The score before the change.
+ */
+void Player::notifyScoreChanged(int oldScore) {
+    if (score.getTotalScore() == oldScore) return;
+    markDirty(DirtyScore);
+    if (observer) {
+        observer->scoreChanged(this, oldScore);
+    }
+}
+
+/**
+ * @brief Notifies the observer about points earned by guessing.
+ * @param oldScore The score before the guess.
+ * @param category Category of the word being guessed.
+ *
+ * Reports the real change, so a penalty clamped at zero reports less.
+ */
+void Player::notifyPointsEarned(int oldScore, CategoryEnum category) {
+    const int points = score.getTotalScore() - oldScore;
+    if (observer && points != 0) {
+        observer->pointsEarned(this, category, points);
+    }
 }
 
 /**
@@ -103,19 +176,46 @@ int Player::getAvatarId() const {
  * @param id Avatar ID value.
  */
 void Player::setAvatarId(int id) {
+    if (avatarId == id) return;
     avatarId = id;
+    markDirty(DirtyAvatar);
+}
+
+/**
+ * @brief Marks a word as completed if not already done.
+ * @param cat The category of the word.
+ * @param position Position of the word in the category's ID list.
+ * @return true if the word was newly completed, false if it already was.
+ * Duplicate detection is a single bit test; each category's bitset grows to
+ * the highest position seen, so it never outgrows its category.
+ */
+bool Player::addCompletedWord(CategoryEnum cat, uint32_t position) {
+    const int bit = static_cast<int>(position);
+    if (bit < 0) return false;
+    QBitArray& completed = completedWords[static_cast<int>(cat)];
+    if (bit >= completed.size()) {
+        completed.resize(bit + 1);
+    }
+    if (completed.testBit(bit)) return false;
+
+    completed.setBit(bit);
+    completedCounts[static_cast<int>(cat)]++;
+    newCompletedWords[static_cast<int>(cat)].append(position);
+    markDirty(DirtyProgress << static_cast<int>(cat));
+    if (observer) observer->wordCompleted(this, cat, position);
+    return true;
 }
 
 /**
- * @brief Adds a completed word to a category if not already added.
+ * @brief Checks whether a word was completed.
  * @param cat The category of the word.
- * @param word The completed word.
+ * @param position Position of the word in the category's ID list.
+ * @return true if the player completed the word.
  */
-void Player::addCompletedWord(CategoryEnum cat, const QString& word) {
-    if (!completedWords[cat].contains(word) )
-        completedWords[cat].append(word);
-    qDebug() << "Added word" << word << "to category" << static_cast<int>(cat);
-    qDebug() << "Current words in category:" << completedWords[cat];
+bool Player::hasCompletedWord(CategoryEnum cat, uint32_t position) const {
+    const QBitArray& completed = completedWords[static_cast<int>(cat)];
+    const int bit = static_cast<int>(position);
+    return bit >= 0 && bit < completed.size() && completed.testBit(bit);
 }
 
 /**
@@ -124,9 +224,9 @@ void Player::addCompletedWord(CategoryEnum cat, const QString& word) {
  */
 int Player::getTotalCompletedCategoriesCount() const {
     int completedCount = 0;
-    for (int i = 0; i < 6; ++i) {
-        CategoryEnum cat = static_cast<CategoryEnum>(i);
-        if (completedWords.value(cat).size() >= 10) {
+    // Unspecified is the last CategoryEnum value and not a playable category
+    for (int i = 0; i < CategoryCount - 1; ++i) {
+        if (completedCounts[i] >= 10) {
             completedCount++;
         }
     }
@@ -139,11 +239,11 @@ int Player::getTotalCompletedCategoriesCount() const {
 void Player::checkAndUpgradeLevel() {
     int count = getTotalCompletedCategoriesCount();
     if (count >= 4) {
-        level = PlayerLevel::Expert;
+        setLevel(PlayerLevel::Expert);
     } else if (count >= 2) {
-        level = PlayerLevel::Intermediate;
+        setLevel(PlayerLevel::Intermediate);
     } else {
-        level = PlayerLevel::Beginner;
+        setLevel(PlayerLevel::Beginner);
     }
 }
 
@@ -153,23 +253,46 @@ void Player::checkAndUpgradeLevel() {
  * @return Number of completed words.
  */
 int Player::getCategoryProgress(CategoryEnum cat) const {
-    return completedWords.value(cat).size();
+    return completedCounts[static_cast<int>(cat)];
 }
 
 /**
- * @brief Retrieves all completed words for a given category.
- * @param cat CategoryEnum value.
- * @return QStringList containing words.
+ * @brief Retrieves the completed words of a category.
+ * @param cat The category.
+ * @return Positions in the category's ID list, in ascending order.
+ */
+QList<uint32_t> Player::getCompletedWords(CategoryEnum cat) const {
+    const QBitArray& completed = completedWords[static_cast<int>(cat)];
+    QList<uint32_t> positions;
+    positions.reserve(completedCounts[static_cast<int>(cat)]);
+    for (int bit = 0; bit < completed.size(); ++bit) {
+        if (completed.testBit(bit)) {
+            positions.append(static_cast<uint32_t>(bit));
+        }
+    }
+    return positions;
+}
+
+/**
+ * @brief Returns the words completed in a category since the previous call.
+ * @param cat The category.
+ * @return Positions in the category's ID list, in the order they were completed.
  */
-QStringList Player::getCompletedWords(CategoryEnum cat) const {
-    return completedWords.value(cat, QStringList());
+QList<uint32_t> Player::takeNewCompletedWords(CategoryEnum cat) {
+    QList<uint32_t> positions;
+    positions.swap(newCompletedWords[static_cast<int>(cat)]);
+    return positions;
 }
 
 /**
  * @brief Clears all completed word records.
+ * The saved words have to go as well, so the next save rewrites every category.
  */
 void Player::clearCompletedWords(){
-    completedWords.clear();
+    for (QBitArray& completed : completedWords) completed.clear();
+    for (QList<uint32_t>& positions : newCompletedWords) positions.clear();
+    completedCounts.fill(0);
+    markDirty(DirtyAllProgress | DirtyProgressReset);
 }
 
 
@@ -2,25 +2,101 @@
 #define PLAYER_H
 
 #include <QString>
-#include <QMap>
-#include <QStringList>
+#include <QList>
+#include <QBitArray>
+#include <array>
+#include <cstdint>
 #include "0_Enums/PlayerLevel.h"
 #include "1_Entities/Score.h"
 #include "0_Enums/CategoryEnum.h"
 
+class Player;
+
+/**
+ * @class PlayerObserver
+ * @brief Interface notified whenever a player's score or saved data changes.
+ */
+class PlayerObserver {
+public:
+    virtual ~PlayerObserver() = default;
+
+    /**
+     * @brief Called after a player's score has changed.
+     * @param player The player whose score changed.
+     * @param oldScore The score before the change.
+     */
+    virtual void scoreChanged(Player* /*player*/, int /*oldScore*/) {}
+
+    /**
+     * @brief Called after a player earned or lost points by guessing.
+     * @param player The player who guessed.
+     * @param category Category of the word being guessed.
+     * @param points Actual change of the score; negative for a penalty.
+     *
+     * Follows the matching scoreChanged call. Scores restored from storage
+     * or reset do not count as earned and only trigger scoreChanged.
+     */
+    virtual void pointsEarned(Player* /*player*/, CategoryEnum /*category*/, int /*points*/) {}
+
+    /**
+     * @brief Called after a player completed a word for the first time.
+     * @param player The player.
+     * @param category Category of the word.
+     * @param position Position of the word in the category's ID list.
+     */
+    virtual void wordCompleted(Player* /*player*/, CategoryEnum /*category*/, uint32_t /*position*/) {}
+
+    /**
+     * @brief Called when a saved player that had no unsaved changes gets one.
+     * @param player The player that became dirty.
+     *
+     * Further changes before the next takeDirtyFields() do not call it again.
+     */
+    virtual void playerChanged(Player* /*player*/) {}
+};
+
 /**
  * @class Player
  * @brief Represents a player in the game.
  */
 class Player {
+public:
+    /** @brief Fields that changed since the player was last saved. */
+    enum DirtyField : unsigned {
+        DirtyScore         = 1u << 0,  ///< Total score
+        DirtyLevel         = 1u << 1,  ///< Player level
+        DirtyAvatar        = 1u << 2,  ///< Avatar ID
+        DirtyLastGameTime  = 1u << 3,  ///< Last game duration
+        DirtyLeaderboard   = 1u << 4,  ///< Points in the windowed and category boards
+        DirtyProgressReset = 1u << 5,  ///< Completed words were cleared; changed categories are saved in full
+        DirtyProgress      = 1u << 8,  ///< Completed words; shifted left by the category index
+        DirtyAllProgress   = ((1u << CategoryCount) - 1) << 8,  ///< Completed words of every category
+        DirtyAll           = ~0u       ///< Everything (a player that was never saved)
+    };
+
 private:
     QString name;                // Player's display name
     PlayerLevel level;           // Player's current skill level
     Score score;                 // Player's score
     int avatarId = 0;            // ID of the player's selected avatar
     int lastGameTime = 0;        // Duration of player's last game session (in seconds)
-    QMap<CategoryEnum, QStringList> completedWords;
-    // Stores completed words grouped by categories
+    std::array<QBitArray, CategoryCount> completedWords;
+    // Per category, one bit per position in the category's ID list, set when the player completed that word
+    std::array<int, CategoryCount> completedCounts{};
+    // Number of completed words per category, indexed by CategoryEnum
+    std::array<QList<uint32_t>, CategoryCount> newCompletedWords;
+    // Per category, positions completed since the last takeNewCompletedWords()
+    PlayerObserver* observer = nullptr;
+    // Notified after every score change (e.g. the ranking index) and on the first unsaved change
+    unsigned dirtyFields = DirtyAll;
+    // DirtyField bits changed since the last save; a new player has never been saved
+    bool profileLoaded = true;
+    // False for a startup summary whose completed words and last game time are still on disk
+
+    void notifyScoreChanged(int oldScore);
+    // Tells the observer about a score change, if the score really changed
+    void notifyPointsEarned(int oldScore, CategoryEnum category);
+    // Tells the observer about points earned in a category by guessing
 
 public:
     /**
@@ -41,10 +117,10 @@ public:
     int getScore() const;
     // Returns the player's score value
 
-    void increaseScoreForCorrectGuess();
-    // Increases score for a correct guess
-    void decreaseScoreForIncorrectGuess();
-    // Decreases score for an incorrect guess
+    void increaseScoreForCorrectGuess(CategoryEnum category = CategoryEnum::Unspecified);
+    // Increases score for a correct guess in the given category
+    void decreaseScoreForIncorrectGuess(CategoryEnum category = CategoryEnum::Unspecified);
+    // Decreases score for an incorrect guess in the given category
     void resetScore();
     // Resets the player's score to default
     void setScore(int savedScore);
@@ -55,13 +131,29 @@ public:
     // Saves the player's last game time
     int getLastGameTime() const;
     // Returns the last recorded game time
+    void setObserver(PlayerObserver* newObserver);
+    // Sets the object notified about score and data changes (nullptr to detach)
+    void markDirty(unsigned fields);
+    // Flags DirtyField bits as unsaved and tells the observer if the player was clean
+    unsigned takeDirtyFields();
+    // Returns the unsaved DirtyField bits and marks the player as saved
+    bool isDirty() const { return dirtyFields != 0; }
+    // Returns whether the player has unsaved changes
+    bool isProfileLoaded() const { return profileLoaded; }
+    // Returns whether completed words and last game time are in memory
+    void setProfileLoaded(bool loaded) { profileLoaded = loaded; }
+    // Marks the player as a summary (false) or a full profile (true)
 
-    void addCompletedWord(CategoryEnum cat, const QString& word);
-    // Adds a completed word under a specific category
+    bool addCompletedWord(CategoryEnum cat, uint32_t position);
+    // Marks the word at a position of the category's ID list as completed; returns false if it already was
+    bool hasCompletedWord(CategoryEnum cat, uint32_t position) const;
+    // Returns whether the player completed the word at a position of the category's ID list
     void clearCompletedWords();
     // Clears all completed word data
-    QStringList getCompletedWords(CategoryEnum cat) const;
-    // Returns completed words for a category
+    QList<uint32_t> getCompletedWords(CategoryEnum cat) const;
+    // Returns the positions of the completed words of a category in ascending order
+    QList<uint32_t> takeNewCompletedWords(CategoryEnum cat);
+    // Returns the positions completed in a category since the previous call and forgets them
     int getCategoryProgress(CategoryEnum cat) const;
     // Returns how many words the player completed in a category
     int getTotalCompletedCategoriesCount() const;
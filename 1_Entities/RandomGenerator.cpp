@@ -0,0 +1,100 @@
+#include "1_Entities/RandomGenerator.h"
+#include <random>
+
+using namespace std;
+
+/**
+ * @brief Rotates a 64-bit value left.
+ *
+ * @param x The value to rotate.
+ * @param k Number of bits (1-63).
+ * @return The rotated value.
+ */
+static inline uint64_t rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+/**
+ * @brief Creates a generator with a seed taken from std::random_device.
+ */
+RandomGenerator::RandomGenerator() {
+    seed(randomSeed());
+}
+
+/**
+ * @brief Creates a generator with a fixed seed.
+ *
+ * @param seed Any 64-bit value; equal seeds give equal sequences.
+ */
+RandomGenerator::RandomGenerator(uint64_t seed) {
+    this->seed(seed);
+}
+
+/**
+ * @brief Restarts the sequence from a seed.
+ *
+ * The four state words are filled by SplitMix64, which never yields an
+ * all-zero state and spreads similar seeds far apart.
+ *
+ * @param seed Any 64-bit value.
+ */
+void RandomGenerator::seed(uint64_t seed) {
+    for (uint64_t& word : state) {
+        uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        word = z ^ (z >> 31);
+    }
+}
+
+/**
+ * @brief Returns the next 64 random bits (xoshiro256**).
+ *
+ * @return A uniformly distributed 64-bit value.
+ */
+uint64_t RandomGenerator::next() {
+    const uint64_t result = rotl(state[1] * 5, 7) * 9;
+    const uint64_t t = state[1] << 17;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotl(state[3], 45);
+
+    return result;
+}
+
+/**
+ * @brief Returns a uniformly distributed value in [0, bound).
+ *
+ * The high half of a 32x32-bit product is the result; products whose low
+ * half falls in the short leftover interval are rejected, which removes
+ * the bias without a division in the common case.
+ *
+ * @param bound Exclusive upper limit; must be greater than zero.
+ * @return A value below bound.
+ */
+uint32_t RandomGenerator::bounded(uint32_t bound) {
+    uint64_t product = uint64_t(uint32_t(next() >> 32)) * bound;
+    uint32_t low = static_cast<uint32_t>(product);
+    if (low < bound) {
+        const uint32_t threshold = (0u - bound) % bound;
+        while (low < threshold) {
+            product = uint64_t(uint32_t(next() >> 32)) * bound;
+            low = static_cast<uint32_t>(product);
+        }
+    }
+    return static_cast<uint32_t>(product >> 32);
+}
+
+/**
+ * @brief Returns a non-deterministic seed from std::random_device.
+ *
+ * @return A 64-bit seed.
+ */
+uint64_t RandomGenerator::randomSeed() {
+    random_device device;
+    return (uint64_t(device()) << 32) ^ device();
+}
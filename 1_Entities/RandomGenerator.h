@@ -0,0 +1,66 @@
+#ifndef RANDOMGENERATOR_H
+#define RANDOMGENERATOR_H
+
+#include <cstdint>
+
+/**
+ * @class RandomGenerator
+ * @brief Small, fast, explicitly seeded pseudo-random number generator.
+ *
+ * Implements xoshiro256** with its state expanded from a 64-bit seed by
+ * SplitMix64. Every owner keeps its own instance, so there is no shared
+ * global state: games running in parallel never contend, and a fixed seed
+ * makes a run fully reproducible.
+ *
+ * Bounded draws use multiply-and-reject (Lemire's method), so every value
+ * in the range is equally likely, unlike rand() % n.
+ */
+class RandomGenerator {
+private:
+    /** Generator state; never all zero */
+    uint64_t state[4];
+
+public:
+    /**
+     * @brief Creates a generator with a seed taken from std::random_device.
+     */
+    RandomGenerator();
+
+    /**
+     * @brief Creates a generator with a fixed seed.
+     *
+     * @param seed Any 64-bit value; equal seeds give equal sequences.
+     */
+    explicit RandomGenerator(uint64_t seed);
+
+    /**
+     * @brief Restarts the sequence from a seed.
+     *
+     * @param seed Any 64-bit value.
+     */
+    void seed(uint64_t seed);
+
+    /**
+     * @brief Returns the next 64 random bits.
+     *
+     * @return A uniformly distributed 64-bit value.
+     */
+    uint64_t next();
+
+    /**
+     * @brief Returns a uniformly distributed value in [0, bound).
+     *
+     * @param bound Exclusive upper limit; must be greater than zero.
+     * @return A value below bound, without modulo bias.
+     */
+    uint32_t bounded(uint32_t bound);
+
+    /**
+     * @brief Returns a non-deterministic seed from std::random_device.
+     *
+     * @return A 64-bit seed.
+     */
+    static uint64_t randomSeed();
+};
+
+#endif // RANDOMGENERATOR_H
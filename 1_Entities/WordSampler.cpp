@@ -0,0 +1,121 @@
+#include "1_Entities/WordSampler.h"
+
+using namespace std;
+
+/**
+ * @brief Creates an empty sampler.
+ */
+WordSampler::WordSampler() : size(0), available(0) {}
+
+/**
+ * @brief Returns the position stored in a slot.
+ *
+ * Slots that were never swapped hold their own position.
+ *
+ * @param slot The slot to read.
+ * @return The stored position.
+ */
+uint32_t WordSampler::getPositionAt(uint32_t slot) const {
+    auto found = positionAt.find(slot);
+    return found == positionAt.end() ? slot : found->second;
+}
+
+/**
+ * @brief Returns the slot a position is stored in.
+ *
+ * @param position The position to find.
+ * @return The slot holding the position.
+ */
+uint32_t WordSampler::getSlotOf(uint32_t position) const {
+    auto found = slotOf.find(position);
+    return found == slotOf.end() ? position : found->second;
+}
+
+/**
+ * @brief Exchanges the contents of two slots.
+ *
+ * @param a First slot.
+ * @param b Second slot.
+ */
+void WordSampler::swapSlots(uint32_t a, uint32_t b) {
+    if (a == b) return;
+
+    uint32_t positionA = getPositionAt(a);
+    uint32_t positionB = getPositionAt(b);
+    positionAt[a] = positionB;
+    positionAt[b] = positionA;
+    slotOf[positionA] = b;
+    slotOf[positionB] = a;
+}
+
+/**
+ * @brief Extends the sampler to cover newly added words.
+ *
+ * A new position starts in its own slot, past the used region, so it is
+ * swapped to the end of the unused region.
+ *
+ * @param newSize Number of words now in the category.
+ */
+void WordSampler::grow(uint32_t newSize) {
+    while (size < newSize) {
+        swapSlots(size, available);
+        ++size;
+        ++available;
+    }
+}
+
+/**
+ * @brief Returns the number of words not used yet.
+ *
+ * @return Number of unused positions.
+ */
+uint32_t WordSampler::remaining() const {
+    return available;
+}
+
+/**
+ * @brief Picks an unused position without marking it as used.
+ *
+ * @param random Generator used for the uniform draw.
+ * @return The chosen position. Only valid while remaining() > 0.
+ */
+uint32_t WordSampler::pick(RandomGenerator& random) const {
+    return getPositionAt(random.bounded(available));
+}
+
+/**
+ * @brief Marks a position as used so it is not picked again.
+ *
+ * The position is swapped with the last unused slot and the unused
+ * region shrinks by one.
+ *
+ * @param position The position to mark.
+ */
+void WordSampler::markUsed(uint32_t position) {
+    if (position >= size) return;
+
+    uint32_t slot = getSlotOf(position);
+    if (slot >= available) return;
+
+    swapSlots(slot, available - 1);
+    --available;
+}
+
+/**
+ * @brief Checks whether a position has been used.
+ *
+ * @param position The position to check.
+ * @return true if the position is used, false otherwise.
+ */
+bool WordSampler::isUsed(uint32_t position) const {
+    return position < size && getSlotOf(position) >= available;
+}
+
+/**
+ * @brief Makes every position available again.
+ *
+ * The permutation stays valid, so only the boundary moves.
+ */
+void WordSampler::reset() {
+    available = size;
+}
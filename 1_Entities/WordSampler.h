@@ -0,0 +1,112 @@
+#ifndef WORDSAMPLER_H
+#define WORDSAMPLER_H
+
+#include <cstdint>
+#include <unordered_map>
+#include "1_Entities/RandomGenerator.h"
+
+/**
+ * @class WordSampler
+ * @brief Draws random unused words from one category in constant time.
+ *
+ * The sampler works on positions 0..size-1 of a category's ID list and
+ * keeps them as a permutation split in two: slots [0, available) hold the
+ * unused positions and the rest hold the used ones. Marking a position as
+ * used swaps it to the end of the unused region, the same step a partial
+ * Fisher–Yates shuffle takes.
+ *
+ * The permutation is stored sparsely: only slots that were ever swapped
+ * have an entry, every other slot holds its own position. Creating a
+ * sampler therefore costs nothing, whatever the category size, and
+ * resetting it only moves the boundary back.
+ */
+class WordSampler {
+private:
+    /** Number of positions the sampler knows about */
+    uint32_t size;
+
+    /** Number of unused positions; they occupy slots [0, available) */
+    uint32_t available;
+
+    /** Position stored in each swapped slot */
+    std::unordered_map<uint32_t, uint32_t> positionAt;
+
+    /** Slot holding each swapped position */
+    std::unordered_map<uint32_t, uint32_t> slotOf;
+
+    /**
+     * @brief Returns the position stored in a slot.
+     *
+     * @param slot The slot to read.
+     * @return The stored position.
+     */
+    uint32_t getPositionAt(uint32_t slot) const;
+
+    /**
+     * @brief Returns the slot a position is stored in.
+     *
+     * @param position The position to find.
+     * @return The slot holding the position.
+     */
+    uint32_t getSlotOf(uint32_t position) const;
+
+    /**
+     * @brief Exchanges the contents of two slots.
+     *
+     * @param a First slot.
+     * @param b Second slot.
+     */
+    void swapSlots(uint32_t a, uint32_t b);
+
+public:
+    /**
+     * @brief Creates an empty sampler.
+     */
+    WordSampler();
+
+    /**
+     * @brief Extends the sampler to cover newly added words.
+     *
+     * New positions start out unused. Shrinking is ignored.
+     *
+     * @param newSize Number of words now in the category.
+     */
+    void grow(uint32_t newSize);
+
+    /**
+     * @brief Returns the number of words not used yet.
+     *
+     * @return Number of unused positions.
+     */
+    uint32_t remaining() const;
+
+    /**
+     * @brief Picks an unused position without marking it as used.
+     *
+     * @param random Generator used for the uniform draw.
+     * @return The chosen position. Only valid while remaining() > 0.
+     */
+    uint32_t pick(RandomGenerator& random) const;
+
+    /**
+     * @brief Marks a position as used so it is not picked again.
+     *
+     * @param position The position to mark.
+     */
+    void markUsed(uint32_t position);
+
+    /**
+     * @brief Checks whether a position has been used.
+     *
+     * @param position The position to check.
+     * @return true if the position is used, false otherwise.
+     */
+    bool isUsed(uint32_t position) const;
+
+    /**
+     * @brief Makes every position available again.
+     */
+    void reset();
+};
+
+#endif // WORDSAMPLER_H
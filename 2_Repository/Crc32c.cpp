@@ -0,0 +1,142 @@
+#include "2_Repository/Crc32c.h"
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define CRC32C_X86 1
+#include <nmmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#elif defined(__ARM_FEATURE_CRC32)
+#define CRC32C_ARM 1
+#include <arm_acle.h>
+#endif
+
+namespace {
+
+/** Reflected CRC32C polynomial */
+constexpr uint32_t Polynomial = 0x82F63B78u;
+
+/** Lookup tables for processing eight bytes per step (slicing-by-8) */
+using SliceTables = std::array<std::array<uint32_t, 256>, 8>;
+
+SliceTables makeTables() {
+    SliceTables tables{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) crc = (crc >> 1) ^ (Polynomial & (0u - (crc & 1u)));
+        tables[0][i] = crc;
+    }
+    for (uint32_t i = 0; i < 256; ++i) {
+        for (int t = 1; t < 8; ++t) {
+            tables[t][i] = (tables[t - 1][i] >> 8) ^ tables[0][tables[t - 1][i] & 0xFF];
+        }
+    }
+    return tables;
+}
+
+/** Table-driven update of an inverted CRC register */
+uint32_t updateSoftware(uint32_t crc, const unsigned char* p, size_t size) {
+    static const SliceTables t = makeTables();
+    while (size >= 8) {
+        uint32_t low, high;
+        std::memcpy(&low, p, 4);
+        std::memcpy(&high, p + 4, 4);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        low = __builtin_bswap32(low);
+        high = __builtin_bswap32(high);
+#endif
+        low ^= crc;
+        crc = t[7][low & 0xFF] ^ t[6][(low >> 8) & 0xFF] ^ t[5][(low >> 16) & 0xFF] ^ t[4][low >> 24]
+              ^ t[3][high & 0xFF] ^ t[2][(high >> 8) & 0xFF] ^ t[1][(high >> 16) & 0xFF] ^ t[0][high >> 24];
+        p += 8;
+        size -= 8;
+    }
+    while (size--) crc = (crc >> 8) ^ t[0][(crc ^ *p++) & 0xFF];
+    return crc;
+}
+
+#if CRC32C_X86
+#if defined(__GNUC__)
+__attribute__((target("sse4.2")))
+#endif
+uint32_t updateHardware(uint32_t crc, const unsigned char* p, size_t size) {
+    uint64_t crc64 = crc;
+    while (size >= 8) {
+        uint64_t word;
+        std::memcpy(&word, p, 8);
+        crc64 = _mm_crc32_u64(crc64, word);
+        p += 8;
+        size -= 8;
+    }
+    crc = static_cast<uint32_t>(crc64);
+    while (size--) crc = _mm_crc32_u8(crc, *p++);
+    return crc;
+}
+
+bool detectHardware() {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 20)) != 0;
+#else
+    return __builtin_cpu_supports("sse4.2");
+#endif
+}
+#elif CRC32C_ARM
+uint32_t updateHardware(uint32_t crc, const unsigned char* p, size_t size) {
+    while (size >= 8) {
+        uint64_t word;
+        std::memcpy(&word, p, 8);
+        crc = __crc32cd(crc, word);
+        p += 8;
+        size -= 8;
+    }
+    while (size--) crc = __crc32cb(crc, *p++);
+    return crc;
+}
+
+bool detectHardware() {
+    return true;
+}
+#endif
+
+using UpdateFunction = uint32_t (*)(uint32_t, const unsigned char*, size_t);
+
+/** Picks the implementation once, on first use */
+UpdateFunction selectUpdate() {
+#if CRC32C_X86 || CRC32C_ARM
+    if (detectHardware()) return updateHardware;
+#endif
+    return updateSoftware;
+}
+
+UpdateFunction update() {
+    static const UpdateFunction selected = selectUpdate();
+    return selected;
+}
+
+} // namespace
+
+namespace Crc32c {
+
+/**
+ * @brief Extends a checksum with more data.
+ * @param crc Checksum of the preceding data (0 for none).
+ * @param data The data.
+ * @param size Number of bytes.
+ * @return Checksum of the preceding data followed by this data.
+ */
+uint32_t extend(uint32_t crc, const void* data, size_t size) {
+    return ~update()(~crc, static_cast<const unsigned char*>(data), size);
+}
+
+/**
+ * @brief Returns whether a CPU instruction computes the checksums.
+ */
+bool isHardwareAccelerated() {
+    return update() != updateSoftware;
+}
+
+} // namespace Crc32c
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file Crc32c.h
+ * @brief CRC32C (Castagnoli) checksums for persisted files.
+ * 
+ * @details
+ * Used for the block checksums of the compiled dictionary and the record
+ * checksums of the journals. The CRC32 instruction of SSE 4.2 (x86-64,
+ * detected at run time) or of ARMv8 (when the compiler targets it) is used
+ * when available; otherwise a table-driven version processes eight bytes
+ * per step. All variants produce the same values.
+ */
+namespace Crc32c {
+
+/**
+ * @brief Extends a checksum with more data.
+ * @param crc Checksum of the preceding data (0 for none).
+ * @param data The data.
+ * @param size Number of bytes.
+ * @return Checksum of the preceding data followed by this data.
+ */
+uint32_t extend(uint32_t crc, const void* data, size_t size);
+
+/**
+ * @brief Computes the checksum of a buffer.
+ * @param data The data.
+ * @param size Number of bytes.
+ * @return The CRC32C of the buffer.
+ */
+inline uint32_t compute(const void* data, size_t size) {
+    return extend(0, data, size);
+}
+
+/**
+ * @brief Returns whether a CPU instruction computes the checksums.
+ */
+bool isHardwareAccelerated();
+
+} // namespace Crc32c
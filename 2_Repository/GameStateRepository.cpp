@@ -1,46 +1,398 @@
 /**
- * @file GameStateRepository.h
+ * @file GameStateRepository.cpp
  * @brief Implementation of the GameStateRepository class.
- * * This class handles the in-memory storage and retrieval of GameState objects.
+ * * Month files are appended to one record at a time and read back lazily,
+ * one month at a time, when a query reaches them.
  */
 
 #include "2_Repository/GameStateRepository.h"
-#include "1_Entities/GameState.h"
+#include "2_Repository/Crc32c.h"
+#include <cstring>
+#include <QDateTime>
 #include <QDebug>
-#include <QList>
+#include <QDir>
+#include <QtEndian>
 
 /**
- * @brief Default constructor for GameStateRepository.
+ * @brief Opens the history kept in a directory.
+ * @param directory Directory of the history files; created on the first save.
+ * * Reads the player names and lists the month files; no record is read yet.
  */
-GameStateRepository::GameStateRepository() {
-    // Constructor
+GameStateRepository::GameStateRepository(const QString& directory)
+    : directory(directory) {
+    const QDir dir(directory);
+
+    QFile names(dir.filePath("players.txt"));
+    if (names.open(QIODevice::ReadOnly)) {
+        const QByteArray data = names.readAll();
+        names.close();
+        int start = 0;
+        while (start < data.size()) {
+            const int end = data.indexOf('\n', start);
+            if (end < 0) break;
+            const QString name = QString::fromUtf8(data.constData() + start, end - start);
+            playerIds.insert(name, static_cast<quint32>(playerNames.size()));
+            playerNames.append(name);
+            start = end + 1;
+        }
+        // A name without its newline was cut short by a crash
+        if (start < data.size()) names.resize(start);
+    }
+
+    for (const QString& file : dir.entryList(QStringList() << "*.wgh", QDir::Files)) {
+        const QDate month = QDate::fromString(file.left(7), "yyyy-MM");
+        if (month.isValid()) partitions.insert(monthKey(month), Partition());
+    }
+}
+
+/**
+ * @brief Adds a session to the history and writes it to its month file.
+ * @param record The session. Records without a player are ignored.
+ * * The record is flushed to the operating system right away; a record
+ * torn by a crash fails its checksum and is dropped on the next start.
+ */
+void GameStateRepository::saveGame(const GameRecord& record) {
+    if (record.player.isEmpty()) return;
+
+    const int key = monthKeyOf(record.startTime);
+    if (!openForAppend(key)) return;
+
+    StoredRecord stored;
+    // A record may only refer to a name that is safely in players.txt
+    if (!playerId(record.player, stored.player)) return;
+    stored.startTime = record.startTime;
+    stored.wordId = record.wordId;
+    stored.duration = static_cast<quint32>(qMax(0, record.durationSeconds));
+    stored.guesses = static_cast<quint16>(qBound(0, record.guesses, 0xFFFF));
+    stored.misses = static_cast<quint16>(qBound(0, record.misses, 0xFFFF));
+    stored.category = static_cast<quint8>(record.category);
+    stored.outcome = static_cast<quint8>(record.outcome);
+
+    char bytes[RecordSize];
+    qToLittleEndian<qint64>(stored.startTime, bytes);
+    qToLittleEndian<quint32>(stored.player, bytes + 8);
+    qToLittleEndian<quint32>(stored.wordId, bytes + 12);
+    qToLittleEndian<quint32>(stored.duration, bytes + 16);
+    qToLittleEndian<quint16>(stored.guesses, bytes + 20);
+    qToLittleEndian<quint16>(stored.misses, bytes + 22);
+    bytes[24] = static_cast<char>(stored.category);
+    bytes[25] = static_cast<char>(stored.outcome);
+    qToLittleEndian<quint16>(0, bytes + 26);
+    qToLittleEndian<quint32>(Crc32c::compute(bytes, RecordSize - 4), bytes + RecordSize - 4);
+
+    if (appendFile.write(bytes, RecordSize) != RecordSize || !appendFile.flush()) {
+        qWarning() << "Cannot write game history" << appendFile.fileName() << appendFile.errorString();
+        appendFile.close();
+        appendKey = -1;
+        return;
+    }
+
+    Partition& part = partitions[key];
+    part.validSize += RecordSize;
+    indexRecord(part, stored);
+}
+
+/**
+ * @brief Retrieves the most recent sessions of a player.
+ * @param player Name of the player.
+ * @param count Maximum number of sessions.
+ * @return The sessions, newest first.
+ * * Months are visited from the newest and only until enough sessions are found.
+ */
+QList<GameRecord> GameStateRepository::getRecentGames(const QString& player, int count) const {
+    QList<GameRecord> games;
+    const auto id = playerIds.constFind(player);
+    if (id == playerIds.constEnd() || count <= 0) return games;
+
+    for (auto it = partitions.end(); it != partitions.begin() && games.size() < count;) {
+        --it;
+        const Partition& part = partition(it.key());
+        const auto positions = part.byPlayer.constFind(*id);
+        if (positions == part.byPlayer.constEnd()) continue;
+        for (int i = positions->size() - 1; i >= 0 && games.size() < count; --i) {
+            games.append(toGameRecord(part.records[(*positions)[i]]));
+        }
+    }
+    return games;
+}
+
+/**
+ * @brief Counts the games and wins of a player over a period.
+ * @param player Name of the player.
+ * @param from First day of the period.
+ * @param to Last day of the period.
+ * @return Games and wins in every category.
+ */
+GameStats GameStateRepository::getStats(const QString& player, const QDate& from, const QDate& to) const {
+    return countGames(player, -1, from, to);
+}
+
+/**
+ * @brief Counts the games and wins of a player in one category over a period.
+ * @param player Name of the player.
+ * @param category Category of the words.
+ * @param from First day of the period.
+ * @param to Last day of the period.
+ * @return Games and wins in the category.
+ */
+GameStats GameStateRepository::getStats(const QString& player, CategoryEnum category,
+                                        const QDate& from, const QDate& to) const {
+    return countGames(player, static_cast<int>(category), from, to);
+}
+
+/**
+ * @brief Counts games over a period, month by month.
+ * @param player Name of the player.
+ * @param category Category to count, or -1 for all.
+ * @param from First day of the period.
+ * @param to Last day of the period.
+ * @return Games and wins.
+ * * Months lying entirely inside the period are answered from their
+ * counters; the first and last month look at the player's records only.
+ */
+GameStats GameStateRepository::countGames(const QString& player, int category,
+                                          const QDate& from, const QDate& to) const {
+    GameStats total;
+    const auto id = playerIds.constFind(player);
+    if (id == playerIds.constEnd() || !from.isValid() || !to.isValid() || from > to) return total;
+
+    const qint64 fromTime = QDateTime(from, QTime(0, 0)).toSecsSinceEpoch();
+    const qint64 toTime = QDateTime(to.addDays(1), QTime(0, 0)).toSecsSinceEpoch();
+    const int lastKey = monthKey(to);
+
+    for (auto it = partitions.lowerBound(monthKey(from)); it != partitions.end() && it.key() <= lastKey; ++it) {
+        const Partition& part = partition(it.key());
+        const QDate firstDay(it.key() / 12, it.key() % 12 + 1, 1);
+
+        if (from <= firstDay && to >= firstDay.addMonths(1).addDays(-1)) {
+            const auto stats = part.stats.constFind(*id);
+            if (stats == part.stats.constEnd()) continue;
+            for (int c = 0; c < CategoryCount; ++c) {
+                if (category >= 0 && c != category) continue;
+                total.games += (*stats)[c].games;
+                total.wins += (*stats)[c].wins;
+            }
+            continue;
+        }
+
+        const auto positions = part.byPlayer.constFind(*id);
+        if (positions == part.byPlayer.constEnd()) continue;
+        for (quint32 position : *positions) {
+            const StoredRecord& r = part.records[position];
+            if (r.startTime < fromTime || r.startTime >= toTime) continue;
+            if (category >= 0 && r.category != category) continue;
+            total.games++;
+            if (r.outcome == static_cast<quint8>(GameOutcome::Won)) total.wins++;
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief Returns the key of the month a day lies in.
+ * @param date The day.
+ * @return Months since year 0.
+ */
+int GameStateRepository::monthKey(const QDate& date) {
+    return date.year() * 12 + date.month() - 1;
+}
+
+/**
+ * @brief Returns the key of the month a session started in, in local time.
+ * @param startTime Seconds since the Unix epoch.
+ */
+int GameStateRepository::monthKeyOf(qint64 startTime) {
+    return monthKey(QDateTime::fromSecsSinceEpoch(startTime).date());
 }
 
 /**
- * @brief Saves a game state by adding it to the internal list.
- * @param gameState Pointer to the GameState object to be saved.
+ * @brief Returns the path of a month file.
+ * @param key Month key.
+ * @return e.g. "<directory>/2026-10.wgh".
  */
-void GameStateRepository::saveGameState(GameState* gameState) {
-    if (gameState != nullptr) {
-        m_gameStates.append(gameState);
+QString GameStateRepository::partitionPath(int key) const {
+    return QDir(directory).filePath(QString("%1-%2.wgh")
+                                        .arg(key / 12, 4, 10, QChar('0'))
+                                        .arg(key % 12 + 1, 2, 10, QChar('0')));
+}
+
+/**
+ * @brief Returns a month, reading and indexing its file on first use.
+ * @param key Month key.
+ * @return The month; empty if it has no file yet.
+ * * Records failing their checksum or naming an unknown player, category
+ * or outcome are skipped. A file whose header cannot be read is left
+ * alone and marked unreadable.
+ */
+GameStateRepository::Partition& GameStateRepository::partition(int key) const {
+    Partition& part = partitions[key];
+    if (part.loaded) return part;
+    part.loaded = true;
+
+    QFile in(partitionPath(key));
+    if (!in.open(QIODevice::ReadOnly)) return part;
+    const QByteArray data = in.readAll();
+    const char* bytes = data.constData();
+    if (data.isEmpty()) return part;
+    if (data.size() < HeaderSize || std::memcmp(bytes, Magic, sizeof(Magic)) != 0
+        || qFromLittleEndian<quint32>(bytes + 4) != Version) {
+        qWarning() << "Ignoring unreadable game history" << in.fileName();
+        part.unreadable = true;
+        return part;
     }
+
+    // Only an incomplete record at the end, torn by a crash, is not part of the file
+    part.validSize = data.size() - (data.size() - HeaderSize) % RecordSize;
+    part.records.reserve(static_cast<int>((part.validSize - HeaderSize) / RecordSize));
+    int damaged = 0;
+    for (qint64 offset = HeaderSize; offset < part.validSize; offset += RecordSize) {
+        const char* p = bytes + offset;
+        if (qFromLittleEndian<quint32>(p + RecordSize - 4) != Crc32c::compute(p, RecordSize - 4)) {
+            damaged++;
+            continue;
+        }
+
+        StoredRecord r;
+        r.startTime = qFromLittleEndian<qint64>(p);
+        r.player = qFromLittleEndian<quint32>(p + 8);
+        r.wordId = qFromLittleEndian<quint32>(p + 12);
+        r.duration = qFromLittleEndian<quint32>(p + 16);
+        r.guesses = qFromLittleEndian<quint16>(p + 20);
+        r.misses = qFromLittleEndian<quint16>(p + 22);
+        r.category = static_cast<quint8>(p[24]);
+        r.outcome = static_cast<quint8>(p[25]);
+        if (r.player >= static_cast<quint32>(playerNames.size()) || r.category >= CategoryCount
+            || r.outcome >= GameOutcomeCount) {
+            continue;
+        }
+        indexRecord(part, r);
+    }
+    if (damaged > 0) qWarning() << "Skipped" << damaged << "damaged record(s) in game history" << in.fileName();
+    return part;
+}
+
+/**
+ * @brief Adds a record to a month and to its indexes.
+ * @param part The month.
+ * @param record The record.
+ */
+void GameStateRepository::indexRecord(Partition& part, const StoredRecord& record) const {
+    part.byPlayer[record.player].append(static_cast<quint32>(part.records.size()));
+    part.records.append(record);
+
+    GameStats& stats = part.stats[record.player][record.category];
+    stats.games++;
+    if (record.outcome == static_cast<quint8>(GameOutcome::Won)) stats.wins++;
 }
 
 /**
- * @brief Retrieves the most recently saved game state.
- * @return Pointer to the last GameState in the list, or nullptr if the list is empty.
+ * @brief Expands a stored record.
+ * @param record The record.
+ * @return The record with the player's name.
  */
-GameState* GameStateRepository::getLastGameState() const {
-    if (m_gameStates.isEmpty()) {
-        return nullptr;
+GameRecord GameStateRepository::toGameRecord(const StoredRecord& record) const {
+    GameRecord game;
+    game.startTime = record.startTime;
+    game.player = playerNames[static_cast<int>(record.player)];
+    game.wordId = record.wordId;
+    game.category = static_cast<CategoryEnum>(record.category);
+    game.outcome = static_cast<GameOutcome>(record.outcome);
+    game.guesses = record.guesses;
+    game.misses = record.misses;
+    game.durationSeconds = static_cast<int>(record.duration);
+    return game;
+}
+
+/**
+ * @brief Looks up the ID of a player, adding the name to players.txt if it is new.
+ * @param name Name of the player.
+ * @param id Receives the line of the name in players.txt.
+ * @return false if a new name could not be written; the name is then not added.
+ */
+bool GameStateRepository::playerId(const QString& name, quint32& id) {
+    const auto found = playerIds.constFind(name);
+    if (found != playerIds.constEnd()) {
+        id = *found;
+        return true;
+    }
+
+    if (!playerFile.isOpen()) {
+        playerFile.setFileName(QDir(directory).filePath("players.txt"));
+        if (!playerFile.open(QIODevice::WriteOnly | QIODevice::Append)) {
+            qWarning() << "Cannot open game history players" << playerFile.fileName() << playerFile.errorString();
+            return false;
+        }
+    }
+    const qint64 oldSize = playerFile.size();
+    QByteArray line = name.toUtf8();
+    line.append('\n');
+    if (playerFile.write(line) != line.size() || !playerFile.flush()) {
+        qWarning() << "Cannot write game history players" << playerFile.fileName() << playerFile.errorString();
+        // A partial line would shift every name written after it
+        playerFile.resize(oldSize);
+        playerFile.close();
+        return false;
     }
-    return m_gameStates.last();
+
+    id = static_cast<quint32>(playerNames.size());
+    playerIds.insert(name, id);
+    playerNames.append(name);
+    return true;
 }
 
 /**
- * @brief Retrieves all saved game states.
- * @return A QList containing pointers to all stored GameState objects.
+ * @brief Opens a month file for appending.
+ * @param key Month key.
+ * @return false if the file cannot be opened.
+ * * The month is loaded first so new records are indexed with the old ones.
+ * An incomplete last record is cut off and a missing or empty file gets a
+ * header. A file with an unreadable header is never overwritten: it is
+ * renamed to `YYYY-MM.wgh.damaged` and the month starts a new file.
  */
-QList<GameState*> GameStateRepository::getAllGameStates() const {
-    return m_gameStates;
+bool GameStateRepository::openForAppend(int key) {
+    if (appendKey == key && appendFile.isOpen()) return true;
+    appendFile.close();
+    appendKey = -1;
+
+    QDir().mkpath(directory);
+    Partition& part = partition(key);
+    const QString path = partitionPath(key);
+
+    if (part.unreadable) {
+        const QString aside = path + ".damaged";
+        if (QFile::exists(aside) || !QFile::rename(path, aside)) {
+            qWarning() << "Not appending to unreadable game history" << path;
+            return false;
+        }
+        qWarning() << "Moved unreadable game history to" << aside;
+        part = Partition();
+        part.loaded = true;
+    }
+
+    appendFile.setFileName(path);
+    if (!appendFile.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qWarning() << "Cannot open game history" << appendFile.fileName() << appendFile.errorString();
+        return false;
+    }
+    if (appendFile.size() == 0) {
+        QByteArray header(Magic, sizeof(Magic));
+        char version[4];
+        qToLittleEndian<quint32>(Version, version);
+        header.append(version, sizeof(version));
+        if (appendFile.write(header) != HeaderSize || !appendFile.flush()) {
+            qWarning() << "Cannot write game history" << appendFile.fileName() << appendFile.errorString();
+            appendFile.resize(0);
+            appendFile.close();
+            return false;
+        }
+        part.validSize = HeaderSize;
+    } else if (part.validSize < appendFile.size()) {
+        qWarning() << "Dropping incomplete record at the end of game history" << appendFile.fileName();
+        if (!appendFile.resize(part.validSize)) {
+            appendFile.close();
+            return false;
+        }
+    }
+    appendKey = key;
+    return true;
 }
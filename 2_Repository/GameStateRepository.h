@@ -1,52 +1,161 @@
 /**
  * @file GameStateRepository.h
  * @brief Header file for the GameStateRepository class.
- * * Defines the storage mechanism for game sessions, allowing for saving 
- * and retrieving GameState objects.
+ * * Defines the persistent history of game sessions: one fixed-size record
+ * per finished or abandoned game, partitioned by month and indexed by player.
  */
 
 #ifndef GAMESTATEREPOSITORY_H
 #define GAMESTATEREPOSITORY_H
 
-#include "1_Entities/GameState.h"
+#include "0_Enums/CategoryEnum.h"
+#include "0_Enums/GameOutcome.h"
+#include <array>
+#include <cstdint>
+#include <QDate>
+#include <QFile>
+#include <QHash>
 #include <QList>
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include <QVector>
 
+/**
+ * @struct GameRecord
+ * @brief One game session as kept in the history.
+ */
+struct GameRecord {
+    qint64 startTime = 0;                               ///< Start of the game, seconds since the Unix epoch
+    QString player;                                     ///< Name of the player
+    uint32_t wordId = 0;                                ///< Dictionary entry ID of the word
+    CategoryEnum category = CategoryEnum::Unspecified;  ///< Category of the word
+    GameOutcome outcome = GameOutcome::Abandoned;       ///< How the game ended
+    int guesses = 0;                                    ///< Letters guessed, correct or not
+    int misses = 0;                                     ///< Incorrect guesses
+    int durationSeconds = 0;                            ///< Time played in seconds
+};
+
+/**
+ * @struct GameStats
+ * @brief Number of games and wins over a period.
+ */
+struct GameStats {
+    int games = 0;  ///< Games played, abandoned ones included
+    int wins = 0;   ///< Games won
+
+    /** @return Share of won games between 0 and 1; 0 when no game was played. */
+    double winRate() const { return games > 0 ? double(wins) / games : 0.0; }
+};
 
 /**
  * @class GameStateRepository
- * @brief Manages a collection of GameState objects.
- * * This repository acts as a data store for game sessions, providing methods 
- * to persist the current state and retrieve historical game data.
+ * @brief Persistent history of game sessions.
+ * * Each session becomes a 32-byte record in the file of the month it
+ * started in (`YYYY-MM.wgh` in the history directory); player names are
+ * stored once in `players.txt` and records refer to them by line number.
+ * * Only the list of month files is read at startup. A month is loaded the
+ * first time a query or a new record needs it; loading builds its
+ * per-player index (record positions in time order) and per-player game
+ * and win counters for each category. "Last N games of a player" walks the
+ * months backwards through that index and stops after N records; statistics
+ * over whole months are read from the counters, and only partially covered
+ * months look at the player's own records.
+ * * Record layout (little-endian): startTime i64, player u32, wordId u32,
+ * duration u32, guesses u16, misses u16, category u8, outcome u8,
+ * reserved u16, then the CRC32C of those 28 bytes. A record failing the
+ * check is skipped; only an incomplete record at the end of a file is cut
+ * off before the next append. A month file whose header cannot be read is
+ * moved aside, never truncated.
  */
 class GameStateRepository {
 public:
     /**
-	 * @brief Constructs a new GameStateRepository object.
-     * * Initialized to manage an empty list of game states.
-	  */
-    GameStateRepository();
+     * @brief Opens the history kept in a directory.
+     * @param directory Directory of the history files; created on the first save.
+     */
+    explicit GameStateRepository(const QString& directory);
+
+    /**
+     * @brief Adds a session to the history and writes it to its month file.
+     * @param record The session. Records without a player are ignored.
+     */
+    void saveGame(const GameRecord& record);
 
     /**
-	  * @brief Adds a GameState to the repository.
-	  * @param gameState Pointer to the GameState object to be stored.
-	  */
-    void saveGameState(GameState* gameState);
-    
+     * @brief Retrieves the most recent sessions of a player.
+     * @param player Name of the player.
+     * @param count Maximum number of sessions.
+     * @return The sessions, newest first.
+     */
+    QList<GameRecord> getRecentGames(const QString& player, int count) const;
+
     /**
-	  * @brief Retrieves the most recently added GameState.
-	  * @return Pointer to the last GameState in the list, or nullptr if no states exist.
-      */
-    GameState* getLastGameState() const;
-    
+     * @brief Counts the games and wins of a player over a period.
+     * @param player Name of the player.
+     * @param from First day of the period.
+     * @param to Last day of the period.
+     * @return Games and wins in every category.
+     */
+    GameStats getStats(const QString& player, const QDate& from, const QDate& to) const;
+
     /**
-	 * @brief Retrieves all stored game states.
-	 * @return A QList containing pointers to all GameState objects in the repository.
-	  */
-    QList<GameState*> getAllGameStates() const;
+     * @brief Counts the games and wins of a player in one category over a period.
+     * @param player Name of the player.
+     * @param category Category of the words.
+     * @param from First day of the period.
+     * @param to Last day of the period.
+     * @return Games and wins in the category.
+     */
+    GameStats getStats(const QString& player, CategoryEnum category, const QDate& from, const QDate& to) const;
 
 private:
-    QList<GameState*> m_gameStates; ///< Internal list storing pointers to game sessions.
-	
+    /** @brief A record as held in memory; the player is an index into playerNames. */
+    struct StoredRecord {
+        qint64 startTime;
+        quint32 player;
+        quint32 wordId;
+        quint32 duration;
+        quint16 guesses;
+        quint16 misses;
+        quint8 category;
+        quint8 outcome;
+    };
+
+    /** @brief The records of one month and their indexes. */
+    struct Partition {
+        bool loaded = false;                                      ///< Records read from the file
+        bool unreadable = false;                                  ///< File exists but its header is not ours
+        qint64 validSize = 0;                                     ///< Bytes of the file up to the last complete record
+        QVector<StoredRecord> records;                            ///< Records in file order
+        QHash<quint32, QVector<quint32>> byPlayer;                ///< Record positions of each player
+        QHash<quint32, std::array<GameStats, CategoryCount>> stats; ///< Games and wins per player and category
+    };
+
+    /** @brief File signature and format version of a month file. */
+    static constexpr char Magic[4] = { 'W', 'G', 'H', '\x1A' };
+    static constexpr quint32 Version = 1;
+    static constexpr int HeaderSize = 8;
+    static constexpr int RecordSize = 32;
+
+    /** @brief Key of a month: months since year 0. */
+    static int monthKey(const QDate& date);
+    static int monthKeyOf(qint64 startTime);
+    QString partitionPath(int key) const;
+
+    Partition& partition(int key) const;
+    void indexRecord(Partition& part, const StoredRecord& record) const;
+    GameRecord toGameRecord(const StoredRecord& record) const;
+    bool playerId(const QString& name, quint32& id);
+    GameStats countGames(const QString& player, int category, const QDate& from, const QDate& to) const;
+    bool openForAppend(int key);
+
+    QString directory;                       ///< Directory of the history files
+    QStringList playerNames;                 ///< Player names by ID, as in players.txt
+    QHash<QString, quint32> playerIds;       ///< ID of each player name
+    QFile playerFile;                        ///< players.txt, open for appending once needed
+    mutable QMap<int, Partition> partitions; ///< Month files by month key; loaded on demand
+    QFile appendFile;                        ///< Month file currently open for appending
+    int appendKey = -1;                      ///< Month key of appendFile
 };
 #endif
-
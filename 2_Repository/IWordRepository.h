@@ -1,6 +1,9 @@
 #pragma once
+#include <deque>
 #include <vector>
-#include "1_Entities/Word.h"
+#include <string_view>
+#include <cstdint>
+#include "1_Entities/DictionaryEntry.h"
 
 /**
  * @class IWordRepository
@@ -8,6 +11,13 @@
  * 
  * This interface defines methods for storing, retrieving, 
  * and accessing words in a repository.
+ * 
+ * Entries are immutable and owned by the repository. References to them
+ * stay valid for the repository's lifetime, so they can be shared by any
+ * number of GuessSession objects without copying.
+ * 
+ * Repositories also keep a per-category index of entry IDs, so callers
+ * can pick a word from one category without scanning the dictionary.
  */
 class IWordRepository {
 public:
@@ -17,21 +27,39 @@ public:
     /**
      * @brief Adds a word to the repository.
      * 
-     * @param word The Word object to add.
+     * @param word The word to add; it is copied into the repository.
+     * @param category The category of the word.
      */
-    virtual void addWord(const Word& word) = 0;
+    virtual void addWord(std::string_view word, CategoryEnum category) = 0;
 
     /**
      * @brief Retrieves a random word from the repository.
      * 
-     * @return A randomly selected Word object.
+     * @return Pointer to a randomly selected entry.
+     */
+    virtual const DictionaryEntry* getRandomWord() = 0;
+
+    /**
+     * @brief Retrieves a word by its entry ID.
+     * 
+     * @param id The entry ID.
+     * @return Pointer to the entry, or nullptr if the ID is unknown.
+     */
+    virtual const DictionaryEntry* getWordById(uint32_t id) = 0;
+
+    /**
+     * @brief Retrieves the IDs of all words in a category.
+     * 
+     * @param category The category to look up.
+     * @return Reference to the category's entry IDs, in insertion order.
+     *         It stays valid and is updated as words are added.
      */
-    virtual Word getRandomWord() = 0;
+    virtual const std::vector<uint32_t>& getWordIdsByCategory(CategoryEnum category) = 0;
 
     /**
      * @brief Retrieves all words in the repository.
      * 
-     * @return A vector containing all Word objects.
+     * @return Reference to the stored entries, indexed by entry ID.
      */
-    virtual std::vector<Word> getAllWords() = 0;
+    virtual const std::deque<DictionaryEntry>& getAllWords() = 0;
 };
@@ -0,0 +1,227 @@
+#include "2_Repository/PlayerJournal.h"
+#include "2_Repository/Crc32c.h"
+#include <cstring>
+#include <QDebug>
+#include <QSaveFile>
+#include <QtEndian>
+#include <QtGlobal>
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+
+/** Appends a little-endian integer to the buffer */
+template <typename T>
+void appendLE(QByteArray& buffer, T value) {
+    char bytes[sizeof(T)];
+    qToLittleEndian<T>(value, bytes);
+    buffer.append(bytes, sizeof(T));
+}
+
+} // namespace
+
+/**
+ * @brief Creates a journal for a file; nothing is opened yet.
+ * @param path Path of the journal file.
+ */
+PlayerJournal::PlayerJournal(const QString& path)
+    : path(path) {
+}
+
+/**
+ * @brief Encodes one record for append().
+ * @param record The record.
+ * @return The encoded bytes. Names and words longer than 65535 bytes are cut.
+ */
+QByteArray PlayerJournal::encode(const Record& record) {
+    const QByteArray name = record.player.toUtf8().left(0xFFFF);
+    const QByteArray word = record.word.toUtf8().left(0xFFFF);
+
+    QByteArray bytes;
+    bytes.reserve(RecordPrefixSize + FixedPayloadSize + name.size() + word.size());
+    appendLE<quint32>(bytes, FixedPayloadSize + name.size() + word.size());
+    appendLE<quint32>(bytes, 0);  // Checksum, filled in below
+    appendLE<quint64>(bytes, record.sequence);
+    bytes.append(static_cast<char>(record.type));
+    bytes.append(static_cast<char>(record.category));
+    appendLE<qint64>(bytes, record.day);
+    appendLE<qint32>(bytes, record.points);
+    appendLE<qint32>(bytes, record.score);
+    appendLE<quint16>(bytes, static_cast<quint16>(name.size()));
+    appendLE<quint16>(bytes, static_cast<quint16>(word.size()));
+    bytes.append(name);
+    bytes.append(word);
+    qToLittleEndian<quint32>(Crc32c::compute(bytes.constData() + RecordPrefixSize, bytes.size() - RecordPrefixSize),
+                             bytes.data() + 4);
+    return bytes;
+}
+
+/**
+ * @brief Decodes the records of a journal image.
+ * @param data The whole file.
+ * @param records Receives the intact records; may be nullptr.
+ * @param version Receives the format version of the file; may be nullptr.
+ * @param damaged Set when a record length cannot be read, so the records
+ *        after it cannot be found; may be nullptr.
+ * @return End of the last complete record, or 0 if the header is not a journal's.
+ * * Records failing their checksum or holding impossible values are skipped;
+ * their length prefix still leads to the next one.
+ */
+qint64 PlayerJournal::parse(const QByteArray& data, QList<Record>* records, quint32* version, bool* damaged) {
+    const char* bytes = data.constData();
+    const qint64 size = data.size();
+    if (damaged) *damaged = false;
+    if (size < HeaderSize || std::memcmp(bytes, Magic, sizeof(Magic)) != 0) return 0;
+
+    const quint32 fileVersion = qFromLittleEndian<quint32>(bytes + 4);
+    if (fileVersion != 1 && fileVersion != Version) return 0;
+    if (version) *version = fileVersion;
+    const int prefixSize = fileVersion == 1 ? RecordPrefixSizeV1 : RecordPrefixSize;
+
+    qint64 offset = HeaderSize;
+    while (size - offset >= prefixSize) {
+        const quint32 payloadSize = qFromLittleEndian<quint32>(bytes + offset);
+        if (payloadSize < FixedPayloadSize || payloadSize > MaxPayloadSize) {
+            if (damaged) *damaged = true;
+            break;
+        }
+        // A record cut short by a crash can only be the last one
+        if (size - offset - prefixSize < payloadSize) break;
+
+        const char* p = bytes + offset + prefixSize;
+        const quint32 crc = qFromLittleEndian<quint32>(bytes + offset + 4);
+        offset += prefixSize + payloadSize;
+        if (prefixSize == RecordPrefixSize && crc != Crc32c::compute(p, payloadSize)) continue;
+        const quint16 nameSize = qFromLittleEndian<quint16>(p + 26);
+        const quint16 wordSize = qFromLittleEndian<quint16>(p + 28);
+        const quint8 type = static_cast<quint8>(p[8]);
+        const quint8 category = static_cast<quint8>(p[9]);
+        if (quint32(FixedPayloadSize) + nameSize + wordSize != payloadSize) continue;
+        if ((type != PointsRecord && type != WordRecord) || category >= CategoryCount) continue;
+
+        if (records) {
+            Record r;
+            r.sequence = qFromLittleEndian<quint64>(p);
+            r.type = static_cast<RecordType>(type);
+            r.category = static_cast<CategoryEnum>(category);
+            r.day = qFromLittleEndian<qint64>(p + 10);
+            r.points = qFromLittleEndian<qint32>(p + 18);
+            r.score = qFromLittleEndian<qint32>(p + 22);
+            r.player = QString::fromUtf8(p + FixedPayloadSize, nameSize);
+            r.word = QString::fromUtf8(p + FixedPayloadSize + nameSize, wordSize);
+            records->append(r);
+        }
+    }
+    return offset;
+}
+
+/**
+ * @brief Reads every complete record of the file.
+ * @return The records in file order; empty if the file is missing or not a journal.
+ */
+QList<PlayerJournal::Record> PlayerJournal::readAll() const {
+    QList<Record> records;
+    QFile in(path);
+    if (in.open(QIODevice::ReadOnly)) {
+        parse(in.readAll(), &records);
+    }
+    return records;
+}
+
+/**
+ * @brief Opens the file for appending, repairing it first.
+ * @return false if the file cannot be opened.
+ * An incomplete last record is cut off so new records stay readable, and a
+ * missing file becomes an empty journal. A file that is not a journal, or
+ * whose record lengths cannot be followed, is never truncated: it is renamed
+ * to `<path>.damaged` and a new journal gets the records still readable.
+ * A version 1 journal is rewritten with checksums.
+ */
+bool PlayerJournal::openForAppend() {
+    if (file.isOpen()) return true;
+
+    qint64 validSize = 0;
+    quint32 fileVersion = Version;
+    bool damaged = false;
+    QList<Record> oldRecords;
+    {
+        QFile in(path);
+        if (in.open(QIODevice::ReadOnly)) {
+            const QByteArray data = in.readAll();
+            in.close();
+            validSize = parse(data, &oldRecords, &fileVersion, &damaged);
+            if (!data.isEmpty() && (validSize == 0 || damaged)) {
+                const QString aside = path + ".damaged";
+                if (QFile::exists(aside) || !QFile::rename(path, aside)) {
+                    qWarning() << "Not appending to unreadable player journal" << path;
+                    return false;
+                }
+                qWarning() << "Moved unreadable player journal to" << aside;
+            }
+        }
+    }
+
+    if (validSize == 0 || damaged || fileVersion != Version) {
+        // Replace the file as a whole so a crash keeps either version
+        QByteArray image(Magic, sizeof(Magic));
+        appendLE<quint32>(image, Version);
+        for (const Record& r : oldRecords) image.append(encode(r));
+
+        QSaveFile out(path);
+        if (!out.open(QIODevice::WriteOnly) || out.write(image) != image.size() || !out.commit()) {
+            qWarning() << "Cannot create player journal" << path << out.errorString();
+            return false;
+        }
+        validSize = image.size();
+    }
+
+    file.setFileName(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qWarning() << "Cannot open player journal" << path << file.errorString();
+        return false;
+    }
+    if (validSize < file.size()) {
+        qWarning() << "Dropping incomplete record at the end of player journal" << path;
+        return file.resize(validSize) && sync();
+    }
+    return true;
+}
+
+/**
+ * @brief Flushes written records to the disk itself.
+ * @return false if the operating system reported an error.
+ */
+bool PlayerJournal::sync() {
+    if (!file.flush()) return false;
+#ifdef Q_OS_WIN
+    return _commit(file.handle()) == 0;
+#else
+    return ::fsync(file.handle()) == 0;
+#endif
+}
+
+/**
+ * @brief Appends encoded records and waits until they are on disk.
+ * @param records One or more encode() results back to back.
+ * @return false if the records could not be written or synced.
+ */
+bool PlayerJournal::append(const QByteArray& records) {
+    if (!openForAppend()) return false;
+    if (file.write(records) != records.size() || !sync()) {
+        qWarning() << "Cannot write player journal" << path << file.errorString();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Drops every record after a checkpoint.
+ * @return false if the file could not be shortened.
+ */
+bool PlayerJournal::truncate() {
+    if (!openForAppend()) return false;
+    return file.resize(HeaderSize) && sync();
+}
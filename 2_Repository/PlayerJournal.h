@@ -0,0 +1,114 @@
+#pragma once
+
+#include <QByteArray>
+#include <QFile>
+#include <QList>
+#include <QString>
+#include "0_Enums/CategoryEnum.h"
+
+/**
+ * @class PlayerJournal
+ * @brief Append-only binary log of score and progress events.
+ *
+ * Every guess that changes a score and every newly completed word becomes
+ * one small record, so a crash loses nothing that reached the journal even
+ * though the player database is only written at checkpoints. Records carry
+ * increasing sequence numbers; the database remembers the last one it
+ * covers, and replay skips everything up to it, so a record is applied at
+ * most once even if the journal outlives its checkpoint.
+ *
+ * Layout (all integers little-endian):
+ *
+ *   Header  Magic "WGJ\x1A", version u32
+ *   Record  payloadSize u32, crc u32 (CRC32C of the payload), then
+ *           sequence u64, type u8, category u8, day i64, points i32,
+ *           score i32, nameSize u16, wordSize u16, name (UTF-8), word (UTF-8)
+ *
+ * A record failing its checksum is skipped; its length still leads to the
+ * next one. Only a record cut short by a crash at the end of the file is
+ * dropped before the next append. A file whose record lengths cannot be
+ * followed is moved aside, never truncated. Version 1 journals (no
+ * checksums) are still read and are rewritten as version 2 before the
+ * first append.
+ * Not synchronized: appends and truncation belong to one thread.
+ */
+class PlayerJournal {
+public:
+    /** @brief Kind of a journal record. */
+    enum RecordType : quint8 {
+        PointsRecord = 1,  ///< Points earned by a guess; score is the new total
+        WordRecord   = 2   ///< A word completed for the first time
+    };
+
+    /** @brief One decoded journal record. */
+    struct Record {
+        quint64 sequence = 0;                           ///< Position in the journal, starting at 1
+        RecordType type = PointsRecord;                 ///< What happened
+        QString player;                                 ///< Player name
+        CategoryEnum category = CategoryEnum::Unspecified; ///< Category of the guessed word
+        qint64 day = 0;                                 ///< Julian day of a PointsRecord
+        int points = 0;                                 ///< Points of a PointsRecord
+        int score = 0;                                  ///< Total score after a PointsRecord
+        QString word;                                   ///< Display text of a WordRecord
+    };
+
+    /**
+     * @brief Creates a journal for a file; nothing is opened yet.
+     * @param path Path of the journal file.
+     */
+    explicit PlayerJournal(const QString& path);
+
+    /**
+     * @brief Encodes one record for append().
+     * @param record The record.
+     * @return The encoded bytes.
+     */
+    static QByteArray encode(const Record& record);
+
+    /**
+     * @brief Reads every complete record of the file.
+     * @return The records in file order; empty if the file is missing or not a journal.
+     */
+    QList<Record> readAll() const;
+
+    /**
+     * @brief Appends encoded records and waits until they are on disk.
+     * @param records One or more encode() results back to back.
+     * @return false if the records could not be written or synced.
+     * One write and one sync cover the whole group.
+     */
+    bool append(const QByteArray& records);
+
+    /**
+     * @brief Drops every record after a checkpoint.
+     * @return false if the file could not be shortened.
+     */
+    bool truncate();
+
+private:
+    /** @brief File signature and format version. */
+    static constexpr char Magic[4] = { 'W', 'G', 'J', '\x1A' };
+    static constexpr quint32 Version = 2;
+    static constexpr int HeaderSize = 8;
+
+    /** @brief Size of the record prefix before the payload, per version. */
+    static constexpr int RecordPrefixSizeV1 = 4;
+    static constexpr int RecordPrefixSize = 8;
+
+    /** @brief Size of the fixed part of a record payload. */
+    static constexpr int FixedPayloadSize = 30;
+
+    /** @brief Largest payload accepted when reading; anything bigger is damage. */
+    static constexpr quint32 MaxPayloadSize = FixedPayloadSize + 2 * 0xFFFF;
+
+    QString path;
+    ///< Path of the journal file.
+
+    QFile file;
+    ///< Open for appending once the first group is written.
+
+    static qint64 parse(const QByteArray& data, QList<Record>* records, quint32* version = nullptr,
+                        bool* damaged = nullptr);
+    bool openForAppend();
+    bool sync();
+};
@@ -0,0 +1,188 @@
+#include "2_Repository/PlayerNameTrie.h"
+
+/**
+ * @brief Creates an empty tree.
+ */
+PlayerNameTrie::PlayerNameTrie()
+    : root{ QString(), nullptr, QVector<Node*>() }, count(0) {}
+
+/**
+ * @brief Frees all nodes; the players are not owned.
+ */
+PlayerNameTrie::~PlayerNameTrie() {
+    clear();
+}
+
+/**
+ * @brief Finds the child whose label starts with a character.
+ * @param node Parent node.
+ * @param first First character of the wanted label.
+ * @param index Receives the position of the child, or where it would be inserted.
+ * @return The child, or nullptr if there is none.
+ */
+PlayerNameTrie::Node* PlayerNameTrie::childFor(const Node* node, QChar first, int* index) {
+    // Children are few and ordered; a binary search keeps wide nodes cheap too
+    int low = 0;
+    int high = node->children.size();
+    while (low < high) {
+        const int middle = (low + high) / 2;
+        if (node->children[middle]->label[0].unicode() < first.unicode()) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    if (index) *index = low;
+    if (low < node->children.size() && node->children[low]->label[0] == first) {
+        return node->children[low];
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Compares the start of an edge label with part of a name, without copying.
+ * @param label Edge label.
+ * @param name Name being looked up.
+ * @param pos Offset in name where the label starts.
+ * @param length Number of characters to compare.
+ * @return true if the characters are equal.
+ */
+bool PlayerNameTrie::matches(const QString& label, const QString& name, int pos, int length) {
+    for (int i = 0; i < length; ++i) {
+        if (label[i] != name[pos + i]) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Appends the players of a subtree in name order.
+ * @param node Subtree root.
+ * @param limit Stop once the result holds this many players.
+ * @param result Receives the players.
+ */
+void PlayerNameTrie::collect(const Node* node, int limit, QList<Player*>& result) {
+    if (node->player) {
+        result.append(node->player);
+    }
+    for (const Node* child : node->children) {
+        if (result.size() >= limit) return;
+        collect(child, limit, result);
+    }
+}
+
+/**
+ * @brief Frees a subtree.
+ * @param node Subtree root.
+ */
+void PlayerNameTrie::destroy(Node* node) {
+    for (Node* child : node->children) {
+        destroy(child);
+        delete child;
+    }
+    node->children.clear();
+}
+
+/**
+ * @brief Stores a player under a name.
+ * @param name Normalized name.
+ * @param player The player.
+ * @return false if the name is already taken; the stored player is kept.
+ */
+bool PlayerNameTrie::insert(const QString& name, Player* player) {
+    if (name.isEmpty() || !player) return false;
+
+    Node* node = &root;
+    int pos = 0;
+    while (pos < name.size()) {
+        int index = 0;
+        Node* child = childFor(node, name[pos], &index);
+        if (!child) {
+            node->children.insert(index, new Node{ name.mid(pos), player, QVector<Node*>() });
+            count++;
+            return true;
+        }
+
+        // Length of the part of the edge label the name shares
+        int common = 1;
+        while (common < child->label.size() && pos + common < name.size()
+               && child->label[common] == name[pos + common]) {
+            common++;
+        }
+
+        if (common < child->label.size()) {
+            // Split the edge: the shared part becomes a new inner node
+            Node* middle = new Node{ child->label.left(common), nullptr, QVector<Node*>() };
+            child->label = child->label.mid(common);
+            middle->children.append(child);
+            node->children[index] = middle;
+            child = middle;
+        }
+        node = child;
+        pos += common;
+    }
+
+    if (node->player) return false;
+    node->player = player;
+    count++;
+    return true;
+}
+
+/**
+ * @brief Returns the player stored under a name.
+ * @param name Normalized name.
+ * @return The player, or nullptr if the name is not stored.
+ */
+Player* PlayerNameTrie::find(const QString& name) const {
+    const Node* node = &root;
+    int pos = 0;
+    while (pos < name.size()) {
+        node = childFor(node, name[pos], nullptr);
+        if (!node || node->label.size() > name.size() - pos
+            || !matches(node->label, name, pos, node->label.size())) return nullptr;
+        pos += node->label.size();
+    }
+    return node->player;
+}
+
+/**
+ * @brief Returns players whose name starts with a prefix.
+ * @param prefix Normalized prefix.
+ * @param limit Maximum number of players to return.
+ * @return Matching players in name order.
+ */
+QList<Player*> PlayerNameTrie::complete(const QString& prefix, int limit) const {
+    QList<Player*> result;
+    if (limit <= 0) return result;
+
+    const Node* node = &root;
+    int pos = 0;
+    while (pos < prefix.size()) {
+        node = childFor(node, prefix[pos], nullptr);
+        if (!node) return result;
+
+        // The prefix may end inside the edge label; the whole subtree still matches
+        const int length = qMin(node->label.size(), prefix.size() - pos);
+        if (!matches(node->label, prefix, pos, length)) return result;
+        pos += length;
+    }
+
+    collect(node, limit, result);
+    return result;
+}
+
+/**
+ * @brief Returns the number of stored names.
+ * @return Name count.
+ */
+int PlayerNameTrie::size() const {
+    return count;
+}
+
+/**
+ * @brief Removes every name.
+ */
+void PlayerNameTrie::clear() {
+    destroy(&root);
+    root.player = nullptr;
+    count = 0;
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <QList>
+#include <QString>
+#include <QVector>
+#include "1_Entities/Player.h"
+
+/**
+ * @class PlayerNameTrie
+ * @brief Compact radix tree mapping normalized player names to players.
+ *
+ * Edges carry whole name fragments instead of single characters, so a
+ * hundred thousand names need roughly one node per name. Completing a
+ * prefix walks down at most prefix-length edges and then visits only the
+ * nodes of the returned names, which keeps a per-keystroke query far below
+ * a millisecond regardless of how many players are registered.
+ *
+ * The tree is not synchronized: it is built and queried on the thread that
+ * owns the PlayerRepository, so a query never waits on a lock.
+ */
+class PlayerNameTrie {
+private:
+    /** @brief One edge and the node it leads to. */
+    struct Node {
+        QString label;            ///< Name fragment on the edge from the parent
+        Player* player;           ///< Player whose name ends here, or nullptr
+        QVector<Node*> children;  ///< Child nodes ordered by first label character
+    };
+
+    Node root;
+    ///< Root node with an empty label.
+
+    int count;
+    ///< Number of names stored.
+
+    static Node* childFor(const Node* node, QChar first, int* index);
+    static bool matches(const QString& label, const QString& name, int pos, int length);
+    static void collect(const Node* node, int limit, QList<Player*>& result);
+    static void destroy(Node* node);
+
+public:
+    /** @brief Creates an empty tree. */
+    PlayerNameTrie();
+
+    /** @brief Frees all nodes (players are not owned). */
+    ~PlayerNameTrie();
+
+    PlayerNameTrie(const PlayerNameTrie&) = delete;
+    PlayerNameTrie& operator=(const PlayerNameTrie&) = delete;
+
+    /**
+     * @brief Stores a player under a name.
+     * @param name Normalized name.
+     * @param player The player.
+     * @return false if the name is already taken; the stored player is kept.
+     */
+    bool insert(const QString& name, Player* player);
+
+    /**
+     * @brief Returns the player stored under a name.
+     * @param name Normalized name.
+     * @return The player, or nullptr if the name is not stored.
+     */
+    Player* find(const QString& name) const;
+
+    /**
+     * @brief Returns players whose name starts with a prefix.
+     * @param prefix Normalized prefix.
+     * @param limit Maximum number of players to return.
+     * @return Matching players in name order; the prefix itself comes first.
+     */
+    QList<Player*> complete(const QString& prefix, int limit) const;
+
+    /**
+     * @brief Returns the number of stored names.
+     * @return Name count.
+     */
+    int size() const;
+
+    /** @brief Removes every name. */
+    void clear();
+};
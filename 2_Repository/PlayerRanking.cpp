@@ -0,0 +1,272 @@
+#include "2_Repository/PlayerRanking.h"
+#include <QVector>
+#include <functional>
+
+/**
+ * @brief Creates an empty ranking.
+ */
+PlayerRanking::PlayerRanking()
+    : root(nullptr), random(0x5EEDu) {}
+
+/**
+ * @brief Frees all nodes; the ranked players are not owned.
+ */
+PlayerRanking::~PlayerRanking() {
+    destroy(root);
+}
+
+/**
+ * @brief Returns the subtree size of a node.
+ * @param node Node or nullptr.
+ * @return Number of nodes below and including node.
+ */
+int PlayerRanking::sizeOf(const Node* node) {
+    return node ? node->size : 0;
+}
+
+/**
+ * @brief Recomputes a node's subtree size from its children.
+ * @param node The node to update.
+ */
+void PlayerRanking::refresh(Node* node) {
+    node->size = 1 + sizeOf(node->left) + sizeOf(node->right);
+}
+
+/**
+ * @brief Checks whether a key ranks before a node.
+ * @param score Score of the key.
+ * @param name Name of the key.
+ * @param player Player of the key; only breaks ties between equal names.
+ * @param node Node to compare against.
+ * @return true if the key has a higher score, or the same score and a smaller name.
+ */
+bool PlayerRanking::ranksBefore(int score, const QString& name, const Player* player, const Node* node) {
+    if (score != node->score) return score > node->score;
+    if (name != node->name) return name < node->name;
+    return std::less<const Player*>()(player, node->player);
+}
+
+/**
+ * @brief Splits a subtree into the nodes ranked before a key and the rest.
+ * @param node Subtree to split.
+ * @param key Node whose stored key splits the subtree.
+ * @param before Receives the nodes ranked before the key.
+ * @param after Receives the remaining nodes.
+ */
+void PlayerRanking::split(Node* node, const Node* key, Node*& before, Node*& after) {
+    if (!node) {
+        before = after = nullptr;
+        return;
+    }
+
+    if (ranksBefore(key->score, key->name, key->player, node)) {
+        split(node->left, key, before, node->left);
+        after = node;
+    } else {
+        split(node->right, key, node->right, after);
+        before = node;
+    }
+    refresh(node);
+}
+
+/**
+ * @brief Joins two subtrees where every node of the first ranks before the second.
+ * @param before Higher-ranked subtree.
+ * @param after Lower-ranked subtree.
+ * @return Root of the joined subtree.
+ */
+PlayerRanking::Node* PlayerRanking::merge(Node* before, Node* after) {
+    if (!before) return after;
+    if (!after) return before;
+
+    if (before->priority > after->priority) {
+        before->right = merge(before->right, after);
+        refresh(before);
+        return before;
+    }
+    after->left = merge(before, after->left);
+    refresh(after);
+    return after;
+}
+
+/**
+ * @brief Unlinks a node from a subtree without freeing it.
+ * @param node Subtree that contains target.
+ * @param target The node to unlink; its stored key locates it.
+ * @return New root of the subtree.
+ */
+PlayerRanking::Node* PlayerRanking::erase(Node* node, const Node* target) {
+    if (!node) return nullptr;
+
+    if (node == target) {
+        return merge(node->left, node->right);
+    }
+    if (ranksBefore(target->score, target->name, target->player, node)) {
+        node->left = erase(node->left, target);
+    } else {
+        node->right = erase(node->right, target);
+    }
+    refresh(node);
+    return node;
+}
+
+/**
+ * @brief Frees a subtree.
+ * @param node Subtree root or nullptr.
+ */
+void PlayerRanking::destroy(Node* node) {
+    if (!node) return;
+    destroy(node->left);
+    destroy(node->right);
+    delete node;
+}
+
+/**
+ * @brief Inserts a player or moves it to match a new score.
+ * @param player The player to rank.
+ * @param score The score to rank the player by.
+ */
+void PlayerRanking::update(Player* player, int score) {
+    if (!player) return;
+
+    Node* node = nodes.value(player, nullptr);
+    if (node) {
+        if (node->score == score) return;
+        root = erase(root, node);
+    } else {
+        node = new Node{ player, score, player->getName(), 0, 1, nullptr, nullptr };
+        node->priority = static_cast<uint32_t>(random.next());
+        nodes.insert(player, node);
+    }
+
+    node->score = score;
+    node->left = node->right = nullptr;
+    node->size = 1;
+
+    Node* before;
+    Node* after;
+    split(root, node, before, after);
+    root = merge(merge(before, node), after);
+}
+
+/**
+ * @brief Removes a player from the ranking.
+ * @param player The player to remove.
+ */
+void PlayerRanking::remove(const Player* player) {
+    Node* node = nodes.take(player);
+    if (!node) return;
+
+    root = erase(root, node);
+    delete node;
+}
+
+/**
+ * @brief Removes every player.
+ */
+void PlayerRanking::clear() {
+    destroy(root);
+    root = nullptr;
+    nodes.clear();
+}
+
+/**
+ * @brief Returns the number of ranked players.
+ * @return Player count.
+ */
+int PlayerRanking::size() const {
+    return sizeOf(root);
+}
+
+/**
+ * @brief Returns the rank of a player.
+ * @param player The player to look up.
+ * @return 1 for the top player, or 0 if the player is not ranked.
+ */
+int PlayerRanking::rankOf(const Player* player) const {
+    const Node* target = nodes.value(player, nullptr);
+    if (!target) return 0;
+
+    int rank = 0;
+    const Node* node = root;
+    while (node) {
+        if (node == target) return rank + sizeOf(node->left) + 1;
+
+        if (ranksBefore(target->score, target->name, target->player, node)) {
+            node = node->left;
+        } else {
+            rank += sizeOf(node->left) + 1;
+            node = node->right;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Returns the player at a rank.
+ * @param rank Rank between 1 and size().
+ * @return The player, or nullptr if the rank is out of range.
+ */
+Player* PlayerRanking::playerAt(int rank) const {
+    if (rank < 1 || rank > size()) return nullptr;
+
+    const Node* node = root;
+    while (node) {
+        const int leftSize = sizeOf(node->left);
+        if (rank == leftSize + 1) return node->player;
+
+        if (rank <= leftSize) {
+            node = node->left;
+        } else {
+            rank -= leftSize + 1;
+            node = node->right;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Returns the best players in rank order.
+ * @param count Maximum number of players to return.
+ * @return Up to count players, highest score first.
+ *
+ * An in-order walk that stops after count players, so the cost is
+ * O(count + log n) rather than a full sort.
+ */
+QList<Player*> PlayerRanking::top(int count) const {
+    QList<Player*> result;
+    if (count <= 0) return result;
+    result.reserve(qMin(count, size()));
+
+    QVector<const Node*> stack;
+    const Node* node = root;
+    while ((node || !stack.isEmpty()) && result.size() < count) {
+        while (node) {
+            stack.append(node);
+            node = node->left;
+        }
+        node = stack.takeLast();
+        result.append(node->player);
+        node = node->right;
+    }
+    return result;
+}
+
+/**
+ * @brief Returns the players ranked next to a player.
+ * @param player The player in the middle.
+ * @param radius Number of players to include on each side.
+ * @return The players from rank - radius to rank + radius, in rank order.
+ */
+QList<Player*> PlayerRanking::around(const Player* player, int radius) const {
+    QList<Player*> result;
+    const int rank = rankOf(player);
+    if (rank == 0) return result;
+
+    const int first = qMax(1, rank - radius);
+    const int last = qMin(size(), rank + radius);
+    for (int r = first; r <= last; ++r) {
+        result.append(playerAt(r));
+    }
+    return result;
+}
@@ -0,0 +1,114 @@
+#ifndef PLAYERRANKING_H
+#define PLAYERRANKING_H
+
+#include <QHash>
+#include <QList>
+#include <QString>
+#include "1_Entities/Player.h"
+#include "1_Entities/RandomGenerator.h"
+
+/**
+ * @class PlayerRanking
+ * @brief Players ordered by score, with O(log n) updates and rank queries.
+ *
+ * An order-statistic treap keyed by (score descending, name ascending).
+ * Every node stores the size of its subtree, so the rank of a player and
+ * the player at a given rank are found in one root-to-leaf walk. Score
+ * changes move a single node instead of re-sorting everyone.
+ *
+ * Each node keeps a copy of the key it was inserted with, so a player can
+ * be repositioned after its score has already changed.
+ */
+class PlayerRanking {
+private:
+    /** @brief One ranked player. */
+    struct Node {
+        Player* player;     ///< The ranked player (not owned)
+        int score;          ///< Score the node is ordered by
+        QString name;       ///< Name used to break score ties
+        uint32_t priority;  ///< Random heap priority that keeps the tree balanced
+        int size;           ///< Number of nodes in this subtree
+        Node* left;         ///< Players ranked higher
+        Node* right;        ///< Players ranked lower
+    };
+
+    Node* root;
+    ///< Root of the treap, or nullptr when empty.
+
+    QHash<const Player*, Node*> nodes;
+    ///< Node of every ranked player.
+
+    RandomGenerator random;
+    ///< Source of node priorities (fixed seed, so shapes are reproducible).
+
+    static int sizeOf(const Node* node);
+    static void refresh(Node* node);
+    static bool ranksBefore(int score, const QString& name, const Player* player, const Node* node);
+    static void split(Node* node, const Node* key, Node*& before, Node*& after);
+    static Node* merge(Node* before, Node* after);
+    static Node* erase(Node* node, const Node* target);
+    static void destroy(Node* node);
+
+public:
+    /** @brief Creates an empty ranking. */
+    PlayerRanking();
+
+    /** @brief Frees all nodes (players are not owned). */
+    ~PlayerRanking();
+
+    PlayerRanking(const PlayerRanking&) = delete;
+    PlayerRanking& operator=(const PlayerRanking&) = delete;
+
+    /**
+     * @brief Inserts a player or moves it to match its current score.
+     * @param player The player to rank.
+     * @param score The score to rank the player by.
+     */
+    void update(Player* player, int score);
+
+    /**
+     * @brief Removes a player from the ranking.
+     * @param player The player to remove.
+     */
+    void remove(const Player* player);
+
+    /** @brief Removes every player. */
+    void clear();
+
+    /**
+     * @brief Returns the number of ranked players.
+     * @return Player count.
+     */
+    int size() const;
+
+    /**
+     * @brief Returns the rank of a player.
+     * @param player The player to look up.
+     * @return 1 for the top player, or 0 if the player is not ranked.
+     */
+    int rankOf(const Player* player) const;
+
+    /**
+     * @brief Returns the player at a rank.
+     * @param rank Rank between 1 and size().
+     * @return The player, or nullptr if the rank is out of range.
+     */
+    Player* playerAt(int rank) const;
+
+    /**
+     * @brief Returns the best players in rank order.
+     * @param count Maximum number of players to return.
+     * @return Up to count players, highest score first.
+     */
+    QList<Player*> top(int count) const;
+
+    /**
+     * @brief Returns the players ranked next to a player.
+     * @param player The player in the middle.
+     * @param radius Number of players to include on each side.
+     * @return The players from rank - radius to rank + radius, in rank order.
+     */
+    QList<Player*> around(const Player* player, int radius) const;
+};
+
+#endif // PLAYERRANKING_H
@@ -1,13 +1,37 @@
 #include "2_Repository/PlayerRepository.h"
 
+/**
+ * @brief Normalizes a player name for indexing and lookup.
+ * @param name Name as typed or stored.
+ * @return The name without surrounding whitespace, in upper case.
+ * Matches the form the login screen stores names in.
+ */
+QString PlayerRepository::normalizeName(const QString& name) {
+    return name.trimmed().toUpper();
+}
+
 /**
  * @brief Adds a player to the repository.
  * @param player Pointer to the Player object to be added.
- * Player is added only if the pointer is not null.
+ * Player is added only if the pointer is not null. The player is ranked
+ * immediately and the repository starts observing its score and changes;
+ * a player that was never saved is remembered as dirty. If another
+ * player already uses the same normalized name, lookups keep returning
+ * the first one.
  */
 void PlayerRepository::addPlayer(Player* player) {
     if (player){
         players.append(player);
+        const QString key = normalizeName(player->getName());
+        if (!playersByName.contains(key)) {
+            playersByName.insert(key, player);
+            nameTrie.insert(key, player);
+        }
+        player->setObserver(this);
+        if (player->isDirty()) {
+            dirtyPlayers.insert(player);
+        }
+        ranking.update(player, player->getScore());
     }
 }
 
@@ -17,11 +41,29 @@ void PlayerRepository::addPlayer(Player* player) {
  * @return Pointer to the Player if found, otherwise nullptr.
  */
 Player* PlayerRepository::getPlayerByName(const QString& name) {
-    for (Player* player : players) {
-        if (player->getName() == name)
-            return player;
-    }
-    return nullptr;
+    return playersByName.value(normalizeName(name), nullptr);
+}
+
+/**
+ * @brief Finds players whose normalized name starts with a prefix.
+ * @param prefix Typed prefix; normalized before lookup.
+ * @param limit Maximum number of players to return.
+ * @return Matching players in name order.
+ * Walks the name radix tree, so the cost depends on the prefix length and
+ * limit only, not on the number of players.
+ */
+QList<Player*> PlayerRepository::findPlayersByPrefix(const QString& prefix, int limit) const {
+    const QString key = normalizeName(prefix);
+    if (key.isEmpty()) return QList<Player*>();
+    return nameTrie.complete(key, limit);
+}
+
+/**
+ * @brief Returns the number of stored players.
+ * @return Player count.
+ */
+int PlayerRepository::getPlayerCount() const {
+    return players.size();
 }
 
 /**
@@ -37,8 +79,94 @@ QList<Player*> PlayerRepository::getAllPlayers() const {
  * Uses qDeleteAll to free memory of all Player pointers.
  */
 void PlayerRepository::clear(){
+    ranking.clear();
+    leaderboards.clear();
+    dirtyPlayers.clear();
+    playersByName.clear();
+    nameTrie.clear();
     qDeleteAll(players);
     players.clear();
 }
 
+/**
+ * @brief Returns the score ranking of all stored players.
+ * @return Reference to the ranking index.
+ */
+const PlayerRanking& PlayerRepository::getRanking() const {
+    return ranking;
+}
+
+/**
+ * @brief Repositions a player in the ranking after a score change, then tells the event listeners.
+ * @param player The player whose score changed.
+ * @param oldScore The score before the change; the ranking keeps its own copy.
+ */
+void PlayerRepository::scoreChanged(Player* player, int oldScore) {
+    ranking.update(player, player->getScore());
+    for (PlayerObserver* listener : eventListeners) listener->scoreChanged(player, oldScore);
+}
+
+/**
+ * @brief Returns the time-windowed and per-category leaderboards.
+ * @return Reference to the leaderboards.
+ */
+ScoreLeaderboards& PlayerRepository::getLeaderboards() {
+    return leaderboards;
+}
 
+/**
+ * @brief Records earned points in the windowed and per-category boards, then tells the event listeners.
+ * @param player The player who guessed.
+ * @param category Category of the word being guessed.
+ * @param points Points earned; negative for a penalty.
+ */
+void PlayerRepository::pointsEarned(Player* player, CategoryEnum category, int points) {
+    leaderboards.record(player, category, points);
+    player->markDirty(Player::DirtyLeaderboard);
+    for (PlayerObserver* listener : eventListeners) listener->pointsEarned(player, category, points);
+}
+
+/**
+ * @brief Passes a newly completed word on to the event listeners.
+ * @param player The player.
+ * @param category Category of the word.
+ * @param position Position of the word in the category's ID list.
+ */
+void PlayerRepository::wordCompleted(Player* player, CategoryEnum category, uint32_t position) {
+    for (PlayerObserver* listener : eventListeners) listener->wordCompleted(player, category, position);
+}
+
+/**
+ * @brief Registers an object to be told about score changes, earned points and completed words.
+ * @param listener The listener; not owned.
+ */
+void PlayerRepository::addEventListener(PlayerObserver* listener) {
+    if (listener && !eventListeners.contains(listener)) eventListeners.append(listener);
+}
+
+/**
+ * @brief Unregisters an event listener.
+ * @param listener The listener added before.
+ */
+void PlayerRepository::removeEventListener(PlayerObserver* listener) {
+    eventListeners.removeAll(listener);
+}
+
+/**
+ * @brief Remembers a player that has unsaved changes.
+ * @param player The player that became dirty.
+ */
+void PlayerRepository::playerChanged(Player* player) {
+    dirtyPlayers.insert(player);
+}
+
+/**
+ * @brief Returns the players with unsaved changes and forgets them.
+ * @return The dirty players.
+ * Costs O(changed players), independent of how many players are stored.
+ */
+QList<Player*> PlayerRepository::takeDirtyPlayers() {
+    QList<Player*> result = dirtyPlayers.values();
+    dirtyPlayers.clear();
+    return result;
+}
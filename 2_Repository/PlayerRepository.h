@@ -1,21 +1,64 @@
 #ifndef PLAYERREPOSITORY_H
 #define PLAYERREPOSITORY_H
 
+#include <QHash>
+#include <QSet>
 #include <QList>
+#include <QString>
 #include "1_Entities/Player.h"
+#include "2_Repository/PlayerNameTrie.h"
+#include "2_Repository/PlayerRanking.h"
+#include "2_Repository/ScoreLeaderboards.h"
 
 /**
  * @class PlayerRepository
  * @brief Stores and manages Player objects.
  *
  * This class provides basic repository operations such as adding players, retrieving players by name, retrieving all players, and clearing the list.
+ * Next to the ordered list it keeps a hash index keyed by normalized name, so lookups
+ * cost O(1) whatever the number of players, and a radix tree of the same names for
+ * prefix lookups (login autocomplete).
+ *
+ * The repository is not synchronized: players are added and looked up on the
+ * thread that owns it (the UI thread). PlayerStore::loadAll() fills it before
+ * the main window is shown.
+ * It also keeps every stored player in a PlayerRanking, updated through PlayerObserver
+ * whenever a score changes, so rank queries never need a full sort. Points earned
+ * by guessing additionally feed the daily, weekly and per-category ScoreLeaderboards.
+ * Score changes, earned points and completed words are also passed on to the
+ * registered event listeners (the PlayerStore journal, the leaderboard view).
  */
-class PlayerRepository {
+class PlayerRepository : public PlayerObserver {
 private:
     QList<Player*> players;
     ///< Internal list storing pointers to Player objects.
 
+    QHash<QString, Player*> playersByName;
+    ///< Players keyed by normalized name, for O(1) lookup.
+
+    PlayerNameTrie nameTrie;
+    ///< The same players in a radix tree of normalized names, for prefix lookup.
+
+    PlayerRanking ranking;
+    ///< Players ordered by score, kept up to date on every score change.
+
+    ScoreLeaderboards leaderboards;
+    ///< Time-windowed and per-category boards fed by earned points.
+
+    QSet<Player*> dirtyPlayers;
+    ///< Players with changes not yet handed to the store.
+
+    QList<PlayerObserver*> eventListeners;
+    ///< Receive score changes, earned points and completed words after the repository; not owned.
+
 public:
+    /**
+     * @brief Normalizes a player name for indexing and lookup.
+     * @param name Name as typed or stored.
+     * @return The name without surrounding whitespace, in upper case.
+     */
+    static QString normalizeName(const QString& name);
+
     /**
      * @brief Adds a new player to the repository.
      * @param player Pointer to the Player object to be added.
@@ -24,11 +67,25 @@ public:
 
     /**
      * @brief Searches for a player by name.
-     * @param name The name of the player being searched for.
+     * @param name The name of the player being searched for; normalized before lookup.
      * @return Pointer to the matching Player, or nullptr if not found.
      */
     Player* getPlayerByName(const QString& name);
 
+    /**
+     * @brief Finds players whose normalized name starts with a prefix.
+     * @param prefix Typed prefix; normalized before lookup.
+     * @param limit Maximum number of players to return.
+     * @return Matching players in name order.
+     */
+    QList<Player*> findPlayersByPrefix(const QString& prefix, int limit) const;
+
+    /**
+     * @brief Returns the number of stored players.
+     * @return Player count.
+     */
+    int getPlayerCount() const;
+
     /**
      * @brief Retrieves all stored players.
      * @return QList containing pointers to all Player objects.
@@ -40,6 +97,66 @@ public:
      * This function uses qDeleteAll to free memory for each Player pointer and then clears the internal list.
      */
     void clear();
+
+    /**
+     * @brief Returns the score ranking of all stored players.
+     * @return Reference to the ranking index.
+     */
+    const PlayerRanking& getRanking() const;
+
+    /**
+     * @brief Repositions a player in the ranking after a score change, then tells the event listeners.
+     * @param player The player whose score changed.
+     * @param oldScore The score before the change.
+     */
+    void scoreChanged(Player* player, int oldScore) override;
+
+    /**
+     * @brief Returns the time-windowed and per-category leaderboards.
+     * @return Reference to the leaderboards.
+     */
+    ScoreLeaderboards& getLeaderboards();
+
+    /**
+     * @brief Records earned points in the windowed and per-category boards, then tells the event listeners.
+     * @param player The player who guessed.
+     * @param category Category of the word being guessed.
+     * @param points Points earned; negative for a penalty.
+     */
+    void pointsEarned(Player* player, CategoryEnum category, int points) override;
+
+    /**
+     * @brief Passes a newly completed word on to the event listeners.
+     * @param player The player.
+     * @param category Category of the word.
+     * @param position Position of the word in the category's ID list.
+     */
+    void wordCompleted(Player* player, CategoryEnum category, uint32_t position) override;
+
+    /**
+     * @brief Registers an object to be told about score changes, earned points and completed words.
+     * @param listener The listener; not owned. Registering it twice has no effect.
+     * Only scoreChanged, pointsEarned and wordCompleted are passed on.
+     */
+    void addEventListener(PlayerObserver* listener);
+
+    /**
+     * @brief Unregisters an event listener.
+     * @param listener The listener added before.
+     */
+    void removeEventListener(PlayerObserver* listener);
+
+    /**
+     * @brief Remembers a player that has unsaved changes.
+     * @param player The player that became dirty.
+     */
+    void playerChanged(Player* player) override;
+
+    /**
+     * @brief Returns the players with unsaved changes and forgets them.
+     * @return The dirty players; their dirty fields are left for the caller to take.
+     */
+    QList<Player*> takeDirtyPlayers();
 };
 
 #endif // PLAYERREPOSITORY_H
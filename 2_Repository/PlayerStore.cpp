@@ -0,0 +1,653 @@
+#include "2_Repository/PlayerStore.h"
+#include <QDebug>
+#include <QFile>
+#include <QSettings>
+#include <QSqlDatabase>
+#include <QSqlError>
+#include <QSqlQuery>
+#include <QVariant>
+
+/**
+ * @brief Opens the database, migrating settings.ini once, and starts the writer.
+ * @param databasePath Path of the SQLite database.
+ * @param journalPath Path of the score and progress journal.
+ * @param legacyPath Path of the INI file used before the database existed.
+ * @param players Repository the players are loaded into; its events are journalled.
+ * @param words Dictionary used for completed words.
+ */
+PlayerStore::PlayerStore(const QString& databasePath, const QString& journalPath, const QString& legacyPath,
+                         PlayerRepository* players, IWordRepository* words)
+    : databasePath(databasePath), legacyPath(legacyPath),
+      readConnection(QString("PlayerStore-read-%1").arg(reinterpret_cast<quintptr>(this))),
+      writeConnection(QString("PlayerStore-write-%1").arg(reinterpret_cast<quintptr>(this))),
+      players(players), words(words), journal(journalPath) {
+    if (openDatabase(readConnection)) {
+        QSqlDatabase db = QSqlDatabase::database(readConnection);
+        createSchema(db);
+    }
+    players->addEventListener(this);
+    writer = std::thread(&PlayerStore::runWriter, this);
+}
+
+/**
+ * @brief Writes everything still queued, then stops the writer.
+ */
+PlayerStore::~PlayerStore() {
+    players->removeEventListener(this);
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+    }
+    queueChanged.notify_all();
+    writer.join();
+
+    {
+        QSqlDatabase db = QSqlDatabase::database(readConnection, false);
+        db.close();
+    }
+    QSqlDatabase::removeDatabase(readConnection);
+}
+
+/**
+ * @brief Opens a named connection to the database.
+ * @param connection Connection name; used only by the calling thread.
+ * @return false if the database cannot be opened.
+ * Every connection uses WAL and NORMAL sync, which is durable across an
+ * application crash and only needs an fsync at checkpoints.
+ */
+bool PlayerStore::openDatabase(const QString& connection) {
+    QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", connection);
+    db.setDatabaseName(databasePath);
+    if (!db.open()) {
+        qWarning() << "Cannot open player database" << databasePath << db.lastError().text();
+        return false;
+    }
+
+    QSqlQuery pragma(db);
+    pragma.exec("PRAGMA journal_mode=WAL");
+    pragma.exec("PRAGMA synchronous=NORMAL");
+    pragma.exec("PRAGMA foreign_keys=ON");
+    return true;
+}
+
+/**
+ * @brief Creates the tables and indexes, and migrates settings.ini once.
+ * @param db Open connection of the owning thread.
+ * user_version stays below SchemaVersion until the schema exists and any
+ * INI data has been copied, so an interrupted migration is simply run again.
+ * Version 1 databases only gain the store_meta table.
+ */
+void PlayerStore::createSchema(QSqlDatabase& db) {
+    QSqlQuery query(db);
+    query.exec("PRAGMA user_version");
+    const int version = query.next() ? query.value(0).toInt() : 0;
+    if (version >= SchemaVersion) return;
+
+    const char* statements[] = {
+        "CREATE TABLE IF NOT EXISTS players ("
+        " id INTEGER PRIMARY KEY,"
+        " name TEXT NOT NULL UNIQUE,"
+        " level INTEGER NOT NULL DEFAULT 0,"
+        " score INTEGER NOT NULL DEFAULT 0,"
+        " avatar INTEGER NOT NULL DEFAULT 0,"
+        " last_time INTEGER NOT NULL DEFAULT 0)",
+        "CREATE INDEX IF NOT EXISTS players_by_score ON players(score DESC, name)",
+        "CREATE TABLE IF NOT EXISTS completed_words ("
+        " player_id INTEGER NOT NULL REFERENCES players(id) ON DELETE CASCADE,"
+        " category INTEGER NOT NULL,"
+        " word TEXT NOT NULL,"
+        " PRIMARY KEY (player_id, category, word)) WITHOUT ROWID",
+        "CREATE TABLE IF NOT EXISTS recent_scores ("
+        " player_id INTEGER NOT NULL REFERENCES players(id) ON DELETE CASCADE,"
+        " day INTEGER NOT NULL,"
+        " category INTEGER NOT NULL,"
+        " points INTEGER NOT NULL,"
+        " PRIMARY KEY (player_id, day, category)) WITHOUT ROWID",
+        "CREATE TABLE IF NOT EXISTS category_scores ("
+        " player_id INTEGER NOT NULL REFERENCES players(id) ON DELETE CASCADE,"
+        " category INTEGER NOT NULL,"
+        " points INTEGER NOT NULL,"
+        " PRIMARY KEY (player_id, category)) WITHOUT ROWID",
+        "CREATE TABLE IF NOT EXISTS store_meta ("
+        " key TEXT PRIMARY KEY,"
+        " value INTEGER NOT NULL)"
+    };
+    for (const char* sql : statements) {
+        if (!query.exec(sql)) {
+            qWarning() << "Cannot create player tables:" << query.lastError().text();
+            return;
+        }
+    }
+
+    if (version < 1 && QFile::exists(legacyPath) && !write(db, readLegacyIni(), 0)) return;
+    query.exec(QString("PRAGMA user_version=%1").arg(SchemaVersion));
+}
+
+/**
+ * @brief Reads every player of the old settings.ini layout.
+ * @return One snapshot per player with all fields flagged.
+ */
+QList<PlayerStore::PlayerChanges> PlayerStore::readLegacyIni() const {
+    QList<PlayerChanges> result;
+    QSettings settings(legacyPath, QSettings::IniFormat);
+    settings.beginGroup("Players");
+
+    for (const QString& name : settings.childGroups()) {
+        settings.beginGroup(name);
+        PlayerChanges c;
+        c.name = name;
+        c.fields = Player::DirtyAll;
+        c.level = settings.value("level", 0).toInt();
+        c.score = settings.value("score", 0).toInt();
+        c.avatar = settings.value("avatar", 0).toInt();
+        c.lastTime = settings.value("lastTime", 0).toInt();
+
+        settings.beginGroup("CompletedWords");
+        for (int i = 0; i < CategoryCount; ++i) {
+            c.completedWords[i] = settings.value(QString::number(i)).toStringList();
+        }
+        settings.endGroup();
+
+        // Recent buckets are "day_category" keys
+        settings.beginGroup("RecentScores");
+        for (const QString& key : settings.childKeys()) {
+            const QStringList parts = key.split('_');
+            if (parts.size() != 2) continue;
+            c.recentBuckets.append(ScoreBucket{ parts[0].toLongLong(),
+                                                static_cast<CategoryEnum>(parts[1].toInt()),
+                                                settings.value(key, 0).toInt() });
+        }
+        settings.endGroup();
+
+        settings.beginGroup("CategoryScores");
+        for (int i = 0; i < CategoryCount; ++i) {
+            c.categoryTotals[i] = settings.value(QString::number(i), 0).toInt();
+        }
+        settings.endGroup();
+        settings.endGroup();
+        result.append(c);
+    }
+    settings.endGroup();
+    return result;
+}
+
+/**
+ * @brief Maps a saved completed word back to its position in the category.
+ * @param category Category the word was saved under.
+ * @param word The saved text.
+ * @param position Receives the position in the category's ID list.
+ * @return false if the word is no longer in the dictionary.
+ * The per-category text index is extended with any entries added since the
+ * last call, so each dictionary word is hashed once per run.
+ */
+bool PlayerStore::findWordPosition(CategoryEnum category, const QString& word, uint32_t& position) {
+    const int index = static_cast<int>(category);
+    QHash<QString, uint32_t>& positions = wordPositionsByText[index];
+    const std::vector<uint32_t>& categoryIds = words->getWordIdsByCategory(category);
+    for (size_t i = wordPositionsIndexed[index]; i < categoryIds.size(); ++i) {
+        if (const DictionaryEntry* entry = words->getWordById(categoryIds[i])) {
+            positions.insert(entry->toQString(), static_cast<uint32_t>(i));
+        }
+    }
+    wordPositionsIndexed[index] = categoryIds.size();
+
+    auto found = positions.constFind(word);
+    if (found == positions.constEnd()) return false;
+    position = found.value();
+    return true;
+}
+
+/**
+ * @brief Returns the dictionary entry of a completed word.
+ * @param category Category of the word.
+ * @param position Position of the word in the category's ID list.
+ * @return The entry, or nullptr if the position is out of range.
+ */
+const DictionaryEntry* PlayerStore::entryAt(CategoryEnum category, uint32_t position) {
+    const std::vector<uint32_t>& categoryIds = words->getWordIdsByCategory(category);
+    return position < categoryIds.size() ? words->getWordById(categoryIds[position]) : nullptr;
+}
+
+/**
+ * @brief Loads a summary of every saved player into the repository.
+ * One query per table; rows are matched to players by their row ID.
+ */
+void PlayerStore::loadAll() {
+    QSqlDatabase db = QSqlDatabase::database(readConnection, false);
+    if (!db.isOpen()) return;
+
+    QSqlQuery query(db);
+    query.setForwardOnly(true);
+    QHash<qint64, Player*> byId;
+    QList<Player*> loaded;
+
+    query.exec("SELECT id, name, level, score, avatar FROM players ORDER BY name");
+    while (query.next()) {
+        Player* p = new Player(query.value(1).toString(), static_cast<PlayerLevel>(query.value(2).toInt()));
+        p->setScore(query.value(3).toInt());
+        p->setAvatarId(query.value(4).toInt());
+        p->setProfileLoaded(false);
+        byId.insert(query.value(0).toLongLong(), p);
+        loaded.append(p);
+    }
+
+    // Everything above came from disk: nothing to save yet
+    for (Player* p : loaded) {
+        p->takeDirtyFields();
+        players->addPlayer(p);
+    }
+
+    // Days outside the weekly window are dropped by the leaderboards
+    ScoreLeaderboards& leaderboards = players->getLeaderboards();
+    query.exec("SELECT player_id, day, category, points FROM recent_scores");
+    while (query.next()) {
+        if (Player* p = byId.value(query.value(0).toLongLong())) {
+            leaderboards.restoreBucket(p, ScoreBucket{ query.value(1).toLongLong(),
+                                                       static_cast<CategoryEnum>(query.value(2).toInt()),
+                                                       query.value(3).toInt() });
+        }
+    }
+
+    query.exec("SELECT player_id, category, points FROM category_scores");
+    while (query.next()) {
+        Player* p = byId.value(query.value(0).toLongLong());
+        const int category = query.value(1).toInt();
+        if (p && category >= 0 && category < CategoryCount) {
+            leaderboards.restoreCategoryTotal(p, static_cast<CategoryEnum>(category), query.value(2).toInt());
+        }
+    }
+
+    replayJournal();
+}
+
+/**
+ * @brief Reads the last journal sequence covered by the database.
+ * @return The sequence number, or 0 if nothing was checkpointed yet.
+ */
+quint64 PlayerStore::readCheckpoint() {
+    QSqlDatabase db = QSqlDatabase::database(readConnection, false);
+    if (!db.isOpen()) return 0;
+    QSqlQuery query(db);
+    query.exec("SELECT value FROM store_meta WHERE key = 'journal_checkpoint'");
+    return query.next() ? query.value(0).toLongLong() : 0;
+}
+
+/**
+ * @brief Applies journal records newer than the last checkpoint, then checkpoints.
+ * Points are applied with the day they were earned on; the score is set to
+ * the journalled total. Records of players that were never saved are
+ * skipped. The store stops listening to the repository meanwhile, so
+ * replayed events are not journalled again.
+ */
+void PlayerStore::replayJournal() {
+    const quint64 checkpoint = readCheckpoint();
+    const QList<PlayerJournal::Record> records = journal.readAll();
+    ScoreLeaderboards& leaderboards = players->getLeaderboards();
+    journalSequence = checkpoint;
+    int replayed = 0;
+
+    players->removeEventListener(this);
+    for (const PlayerJournal::Record& r : records) {
+        journalSequence = qMax(journalSequence, r.sequence);
+        if (r.sequence <= checkpoint) continue;
+        Player* p = players->getPlayerByName(r.player);
+        if (!p) continue;
+
+        loadProfile(p);
+        if (r.type == PlayerJournal::PointsRecord) {
+            p->setScore(r.score);
+            leaderboards.record(p, r.category, r.points, r.day);
+            p->markDirty(Player::DirtyLeaderboard);
+        } else {
+            uint32_t position;
+            if (findWordPosition(r.category, r.word, position)) p->addCompletedWord(r.category, position);
+        }
+        replayed++;
+    }
+    players->addEventListener(this);
+
+    if (replayed > 0) qDebug() << "Replayed" << replayed << "player journal record(s)";
+    // Checkpoint even if nothing was newer, so the journal starts empty
+    recordsSinceCheckpoint = records.size();
+    saveChanges();
+}
+
+/**
+ * @brief Reads the completed words and last game time of one player.
+ * @param player A player from loadAll(); full profiles are left alone.
+ * Both lookups go through an index (player name, then the word table's key).
+ */
+void PlayerStore::loadProfile(Player* player) {
+    if (player->isProfileLoaded()) return;
+    QSqlDatabase db = QSqlDatabase::database(readConnection, false);
+    if (!db.isOpen()) return;
+
+    QSqlQuery query(db);
+    query.setForwardOnly(true);
+    query.prepare("SELECT id, last_time FROM players WHERE name = ?");
+    query.bindValue(0, player->getName());
+    if (!query.exec() || !query.next()) return;
+    const qint64 id = query.value(0).toLongLong();
+    const int lastTime = query.value(1).toInt();
+
+    // Loaded values are already saved; changes made before the load are not.
+    // The repository is detached meanwhile so loading does not list the player as dirty.
+    player->setObserver(nullptr);
+    const unsigned unsaved = player->takeDirtyFields();
+    player->setLastGameTime(lastTime);
+
+    query.prepare("SELECT category, word FROM completed_words WHERE player_id = ?");
+    query.bindValue(0, id);
+    if (query.exec()) {
+        while (query.next()) {
+            const int category = query.value(0).toInt();
+            if (category < 0 || category >= CategoryCount) continue;
+            const CategoryEnum cat = static_cast<CategoryEnum>(category);
+            uint32_t position;
+            if (findWordPosition(cat, query.value(1).toString(), position)) player->addCompletedWord(cat, position);
+        }
+    }
+
+    player->takeDirtyFields();
+    for (int i = 0; i < CategoryCount; ++i) player->takeNewCompletedWords(static_cast<CategoryEnum>(i));
+    player->setProfileLoaded(true);
+    player->setObserver(players);
+    if (unsaved != 0) player->markDirty(unsaved);
+}
+
+/**
+ * @brief Copies the changed fields of a player.
+ * @param player The player.
+ * @param fields Player::DirtyField bits to copy.
+ * @return The snapshot; only the flagged fields are meaningful.
+ * Completed words are the ones added since the last snapshot, or every word
+ * of the category after the player's words were cleared.
+ */
+PlayerStore::PlayerChanges PlayerStore::snapshot(Player* player, unsigned fields) {
+    PlayerChanges changes;
+    changes.name = player->getName();
+    changes.fields = fields;
+    changes.level = static_cast<int>(player->getLevelEnum());
+    changes.score = player->getScore();
+    changes.avatar = player->getAvatarId();
+    changes.lastTime = player->getLastGameTime();
+    changes.categoryTotals.fill(0);
+
+    for (int i = 0; i < CategoryCount; ++i) {
+        if (!(fields & (Player::DirtyProgress << i))) continue;
+        const CategoryEnum category = static_cast<CategoryEnum>(i);
+        const QList<uint32_t> added = player->takeNewCompletedWords(category);
+        const QList<uint32_t> positions =
+            (fields & Player::DirtyProgressReset) ? player->getCompletedWords(category) : added;
+        for (uint32_t position : positions) {
+            if (const DictionaryEntry* entry = entryAt(category, position)) {
+                changes.completedWords[i].append(entry->toQString());
+            }
+        }
+    }
+
+    if (fields & Player::DirtyLeaderboard) {
+        ScoreLeaderboards& leaderboards = players->getLeaderboards();
+        changes.recentBuckets = leaderboards.recentBuckets(player);
+        for (int i = 0; i < CategoryCount; ++i) {
+            changes.categoryTotals[i] =
+                leaderboards.window(LeaderboardPeriod::AllTime, static_cast<CategoryEnum>(i))->scoreOf(player);
+        }
+    }
+    return changes;
+}
+
+/**
+ * @brief Queues the changed fields of every dirty player for writing.
+ */
+void PlayerStore::saveChanges() {
+    QList<PlayerChanges> batch;
+    for (Player* p : players->takeDirtyPlayers()) {
+        unsigned fields = p->takeDirtyFields();
+        // A summary holds no words or last game time; keep the saved ones
+        if (!p->isProfileLoaded()) {
+            fields &= ~(Player::DirtyAllProgress | Player::DirtyProgressReset | Player::DirtyLastGameTime);
+        }
+        if (fields != 0) {
+            batch.append(snapshot(p, fields));
+        }
+    }
+    // Every journalled event so far has marked its player dirty, so the batch covers it
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        // Snapshots left by a failed write are retried even if nothing else changed
+        if (batch.isEmpty() && recordsSinceCheckpoint == 0 && pending.isEmpty()) return;
+        pending.append(batch);
+        checkpointPending = true;
+        pendingCheckpoint = journalSequence;
+    }
+    recordsSinceCheckpoint = 0;
+    queueChanged.notify_all();
+}
+
+/**
+ * @brief Saves if CheckpointInterval records were journalled since the last save.
+ */
+void PlayerStore::checkpointIfDue() {
+    if (recordsSinceCheckpoint >= CheckpointInterval) saveChanges();
+}
+
+/**
+ * @brief Journals points earned by a guess.
+ * @param player The player who guessed.
+ * @param category Category of the word being guessed.
+ * @param points Actual change of the score.
+ */
+void PlayerStore::pointsEarned(Player* player, CategoryEnum category, int points) {
+    PlayerJournal::Record record;
+    record.type = PlayerJournal::PointsRecord;
+    record.player = player->getName();
+    record.category = category;
+    record.day = ScoreLeaderboards::today();
+    record.points = points;
+    record.score = player->getScore();
+    appendToJournal(record);
+}
+
+/**
+ * @brief Journals a newly completed word.
+ * @param player The player.
+ * @param category Category of the word.
+ * @param position Position of the word in the category's ID list.
+ */
+void PlayerStore::wordCompleted(Player* player, CategoryEnum category, uint32_t position) {
+    const DictionaryEntry* entry = entryAt(category, position);
+    if (!entry) return;
+
+    PlayerJournal::Record record;
+    record.type = PlayerJournal::WordRecord;
+    record.player = player->getName();
+    record.category = category;
+    record.word = entry->toQString();
+    appendToJournal(record);
+}
+
+/**
+ * @brief Numbers a record and queues it for the writer's next group commit.
+ * @param record The record; its sequence number is assigned here.
+ */
+void PlayerStore::appendToJournal(PlayerJournal::Record record) {
+    record.sequence = ++journalSequence;
+    const QByteArray bytes = PlayerJournal::encode(record);
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        pendingRecords.append(bytes);
+        pendingRecordsEnd = record.sequence;
+    }
+    recordsSinceCheckpoint++;
+    queueChanged.notify_all();
+}
+
+/**
+ * @brief Blocks until every queued snapshot and journal record is on disk.
+ */
+void PlayerStore::flush() {
+    std::unique_lock<std::mutex> lock(queueMutex);
+    queueChanged.wait(lock, [this] {
+        return !checkpointPending && pendingRecords.isEmpty() && !writing;
+    });
+}
+
+/**
+ * @brief Writer thread: writes queued records and snapshots until the store is destroyed.
+ * The thread owns its own connection and the journal file. Queued snapshots
+ * go out in a single transaction; the journal is emptied once such a
+ * checkpoint covers every record already written to it. Journal records
+ * queued since the previous pass are then appended and synced together.
+ * Snapshots that could not be written stay queued ahead of newer ones and
+ * are retried with the next checkpoint; level and avatar changes are not
+ * journalled, so dropping them would lose them.
+ */
+void PlayerStore::runWriter() {
+    const bool opened = openDatabase(writeConnection);
+    quint64 journalWritten = 0;
+    {
+        QSqlDatabase db = QSqlDatabase::database(writeConnection, false);
+        std::unique_lock<std::mutex> lock(queueMutex);
+        while (true) {
+            queueChanged.wait(lock, [this] {
+                return stopping || checkpointPending || !pendingRecords.isEmpty();
+            });
+            if (!checkpointPending && pendingRecords.isEmpty()) break;
+
+            QList<PlayerChanges> batch;
+            batch.swap(pending);
+            const QByteArray records = pendingRecords;
+            const quint64 recordsEnd = pendingRecordsEnd;
+            const bool checkpoint = checkpointPending;
+            const quint64 covered = pendingCheckpoint;
+            pendingRecords.clear();
+            checkpointPending = false;
+            writing = true;
+            lock.unlock();
+
+            // The checkpoint goes first, so records taken in this pass land in the emptied journal
+            const bool saved = checkpoint && opened && write(db, batch, covered);
+            if (saved && covered >= journalWritten) journal.truncate();
+            if (!records.isEmpty() && journal.append(records)) journalWritten = recordsEnd;
+
+            lock.lock();
+            if (checkpoint && !saved && !batch.isEmpty()) {
+                batch.append(pending);
+                pending.swap(batch);
+            }
+            writing = false;
+            queueChanged.notify_all();
+        }
+        db.close();
+    }
+    QSqlDatabase::removeDatabase(writeConnection);
+}
+
+/**
+ * @brief Writes snapshots in one transaction.
+ * @param db Open connection of the calling thread.
+ * @param batch Snapshots in the order they were taken; later ones win.
+ * @param checkpoint Last journal sequence the batch covers; 0 leaves it unchanged.
+ * @return false if the transaction was rolled back.
+ * Only rows of flagged fields are touched; completed words are only
+ * inserted, unless the snapshot replaces a category's words as a whole.
+ * Statements are prepared once per batch and re-bound for every player.
+ */
+bool PlayerStore::write(QSqlDatabase& db, const QList<PlayerChanges>& batch, quint64 checkpoint) {
+    if (!db.transaction()) {
+        qWarning() << "Cannot start player transaction:" << db.lastError().text();
+        return false;
+    }
+
+    QSqlQuery insertPlayer(db), findPlayer(db), updatePlayer(db), updateLastTime(db);
+    QSqlQuery clearWords(db), insertWord(db);
+    QSqlQuery clearRecent(db), insertRecent(db), clearTotals(db), insertTotal(db);
+    insertPlayer.prepare("INSERT OR IGNORE INTO players (name) VALUES (?)");
+    findPlayer.prepare("SELECT id FROM players WHERE name = ?");
+    updatePlayer.prepare("UPDATE players SET level = ?, score = ?, avatar = ? WHERE id = ?");
+    updateLastTime.prepare("UPDATE players SET last_time = ? WHERE id = ?");
+    clearWords.prepare("DELETE FROM completed_words WHERE player_id = ? AND category = ?");
+    insertWord.prepare("INSERT OR IGNORE INTO completed_words (player_id, category, word) VALUES (?, ?, ?)");
+    clearRecent.prepare("DELETE FROM recent_scores WHERE player_id = ?");
+    insertRecent.prepare("INSERT OR REPLACE INTO recent_scores (player_id, day, category, points) VALUES (?, ?, ?, ?)");
+    clearTotals.prepare("DELETE FROM category_scores WHERE player_id = ?");
+    insertTotal.prepare("INSERT INTO category_scores (player_id, category, points) VALUES (?, ?, ?)");
+
+    const unsigned summaryFields = Player::DirtyLevel | Player::DirtyScore | Player::DirtyAvatar;
+    bool ok = true;
+
+    for (const PlayerChanges& c : batch) {
+        insertPlayer.bindValue(0, c.name);
+        findPlayer.bindValue(0, c.name);
+        ok = insertPlayer.exec() && findPlayer.exec() && findPlayer.next();
+        if (!ok) break;
+        const qint64 id = findPlayer.value(0).toLongLong();
+        findPlayer.finish();
+
+        // The snapshot holds every summary column, so one statement covers any of them
+        if (c.fields & summaryFields) {
+            updatePlayer.bindValue(0, c.level);
+            updatePlayer.bindValue(1, c.score);
+            updatePlayer.bindValue(2, c.avatar);
+            updatePlayer.bindValue(3, id);
+            if (!(ok = updatePlayer.exec())) break;
+        }
+        if (c.fields & Player::DirtyLastGameTime) {
+            updateLastTime.bindValue(0, c.lastTime);
+            updateLastTime.bindValue(1, id);
+            if (!(ok = updateLastTime.exec())) break;
+        }
+
+        for (int i = 0; i < CategoryCount && ok; ++i) {
+            if (!(c.fields & (Player::DirtyProgress << i))) continue;
+            if (c.fields & Player::DirtyProgressReset) {
+                clearWords.bindValue(0, id);
+                clearWords.bindValue(1, i);
+                ok = clearWords.exec();
+            }
+            for (const QString& word : c.completedWords[i]) {
+                if (!ok) break;
+                insertWord.bindValue(0, id);
+                insertWord.bindValue(1, i);
+                insertWord.bindValue(2, word);
+                ok = insertWord.exec();
+            }
+        }
+        if (!ok) break;
+
+        if (c.fields & Player::DirtyLeaderboard) {
+            clearRecent.bindValue(0, id);
+            clearTotals.bindValue(0, id);
+            ok = clearRecent.exec() && clearTotals.exec();
+            for (const ScoreBucket& bucket : c.recentBuckets) {
+                if (!ok) break;
+                insertRecent.bindValue(0, id);
+                insertRecent.bindValue(1, bucket.day);
+                insertRecent.bindValue(2, static_cast<int>(bucket.category));
+                insertRecent.bindValue(3, bucket.points);
+                ok = insertRecent.exec();
+            }
+            for (int i = 0; i < CategoryCount && ok; ++i) {
+                if (c.categoryTotals[i] == 0) continue;
+                insertTotal.bindValue(0, id);
+                insertTotal.bindValue(1, i);
+                insertTotal.bindValue(2, c.categoryTotals[i]);
+                ok = insertTotal.exec();
+            }
+            if (!ok) break;
+        }
+    }
+
+    if (ok && checkpoint > 0) {
+        QSqlQuery saveCheckpoint(db);
+        saveCheckpoint.prepare("INSERT OR REPLACE INTO store_meta (key, value) VALUES ('journal_checkpoint', ?)");
+        saveCheckpoint.bindValue(0, static_cast<qint64>(checkpoint));
+        ok = saveCheckpoint.exec();
+    }
+
+    if (ok && db.commit()) return true;
+    qWarning() << "Player changes not saved:" << db.lastError().text();
+    db.rollback();
+    return false;
+}
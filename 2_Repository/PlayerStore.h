@@ -0,0 +1,212 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QStringList>
+#include "2_Repository/IWordRepository.h"
+#include "2_Repository/PlayerJournal.h"
+#include "2_Repository/PlayerRepository.h"
+
+class QSqlDatabase;
+
+/**
+ * @class PlayerStore
+ * @brief Keeps players in an SQLite database and saves only what changed.
+ *
+ * The database runs in WAL mode, so the background writer never blocks
+ * readers. Players are one row each with indexed name and score columns;
+ * completed words, recent score buckets and category totals live in
+ * their own tables keyed by player.
+ *
+ * Players flag the fields they change (Player::DirtyField) and the
+ * repository remembers which players are dirty. saveChanges() copies just
+ * those fields into a snapshot on the calling thread, in time proportional
+ * to the number of changed players, and hands it to a background writer.
+ * The UI thread therefore never waits on disk; snapshots queued while the
+ * writer is busy are written together in one transaction.
+ *
+ * Startup only loads a summary of each player (name, level, score, avatar)
+ * plus the bounded leaderboard windows. Completed words and the last game
+ * time are read by loadProfile() for the player who logs in, so startup
+ * time and memory do not grow with the players' histories.
+ *
+ * Between saves, every guess that changes a score and every newly completed
+ * word is appended to a PlayerJournal. The writer thread writes whatever
+ * records have queued up with one write and one sync (group commit), so a
+ * guess never waits for the disk. Every CheckpointInterval records, and on
+ * every save, a checkpoint writes the dirty players to the database
+ * together with the last journal sequence they cover; the journal is then
+ * emptied. loadAll() replays records newer than the last checkpoint.
+ *
+ * A database without a schema version is filled once from the old
+ * settings.ini layout; the INI file is left untouched.
+ *
+ * Completed words are saved as text, because entry IDs differ between
+ * words.txt and a compiled words.wgd.
+ */
+class PlayerStore : public PlayerObserver {
+private:
+    /** @brief Saved values of one player's changed fields. */
+    struct PlayerChanges {
+        QString name;                                          ///< Unique player name
+        unsigned fields;                                       ///< Player::DirtyField bits to write
+        int level;                                             ///< Level as stored integer
+        int score;                                             ///< Total score
+        int avatar;                                            ///< Avatar ID
+        int lastTime;                                          ///< Last game duration
+        std::array<QStringList, CategoryCount> completedWords; ///< New words of each changed category; all of them after a reset
+        QList<ScoreBucket> recentBuckets;                      ///< Buckets inside the weekly window
+        std::array<int, CategoryCount> categoryTotals;         ///< All-time points per category
+    };
+
+    /** @brief Schema version stored in PRAGMA user_version. */
+    static constexpr int SchemaVersion = 2;
+
+    /** @brief Journal records after which checkpointIfDue() saves. */
+    static constexpr int CheckpointInterval = 50;
+
+    QString databasePath;
+    ///< Path of the SQLite database.
+
+    QString legacyPath;
+    ///< Path of the settings.ini migrated on first run.
+
+    QString readConnection;
+    ///< Name of the connection used on the owning thread.
+
+    QString writeConnection;
+    ///< Name of the connection used by the writer thread.
+
+    PlayerRepository* players;
+    ///< Repository filled on load and scanned for dirty players on save.
+
+    IWordRepository* words;
+    ///< Dictionary used to map completed words between text and entry ID.
+
+    PlayerJournal journal;
+    ///< Score and progress events since the last checkpoint; written by the writer thread.
+
+    quint64 journalSequence = 0;
+    ///< Sequence number of the newest journal record (owning thread).
+
+    int recordsSinceCheckpoint = 0;
+    ///< Journal records queued since the last saveChanges() (owning thread).
+
+    std::array<QHash<QString, uint32_t>, CategoryCount> wordPositionsByText;
+    ///< Positions in each category's ID list by word text.
+
+    std::array<size_t, CategoryCount> wordPositionsIndexed{};
+    ///< Category entries already in wordPositionsByText.
+
+    std::thread writer;
+    ///< Background thread writing queued snapshots.
+
+    std::mutex queueMutex;
+    ///< Guards pending, writing and stopping.
+
+    std::condition_variable queueChanged;
+    ///< Signals new snapshots, a finished write or shutdown.
+
+    QList<PlayerChanges> pending;
+    ///< Snapshots waiting for the writer, oldest first.
+
+    QByteArray pendingRecords;
+    ///< Encoded journal records waiting for the writer.
+
+    quint64 pendingRecordsEnd = 0;
+    ///< Sequence number of the last record in pendingRecords.
+
+    bool checkpointPending = false;
+    ///< True when a checkpoint is queued with pending.
+
+    quint64 pendingCheckpoint = 0;
+    ///< Journal sequence covered by the queued snapshots.
+
+    bool writing = false;
+    ///< True while the writer is writing a batch.
+
+    bool stopping = false;
+    ///< Tells the writer to exit once the queue is empty.
+
+    bool findWordPosition(CategoryEnum category, const QString& word, uint32_t& position);
+    const DictionaryEntry* entryAt(CategoryEnum category, uint32_t position);
+    PlayerChanges snapshot(Player* player, unsigned fields);
+    void runWriter();
+    bool openDatabase(const QString& connection);
+    void createSchema(QSqlDatabase& db);
+    QList<PlayerChanges> readLegacyIni() const;
+    quint64 readCheckpoint();
+    void appendToJournal(PlayerJournal::Record record);
+    void replayJournal();
+    static bool write(QSqlDatabase& db, const QList<PlayerChanges>& batch, quint64 checkpoint);
+
+public:
+    /**
+     * @brief Opens the database, migrating settings.ini once, and starts the writer.
+     * @param databasePath Path of the SQLite database.
+     * @param journalPath Path of the score and progress journal.
+     * @param legacyPath Path of the INI file used before the database existed.
+     * @param players Repository the players are loaded into; its events are journalled.
+     * @param words Dictionary used for completed words.
+     */
+    PlayerStore(const QString& databasePath, const QString& journalPath, const QString& legacyPath,
+                PlayerRepository* players, IWordRepository* words);
+
+    /** @brief Writes everything still queued, then stops the writer. */
+    ~PlayerStore();
+
+    PlayerStore(const PlayerStore&) = delete;
+    PlayerStore& operator=(const PlayerStore&) = delete;
+
+    /**
+     * @brief Loads a summary of every saved player into the repository.
+     * Loaded players start clean, so only later changes are saved. Their
+     * profiles are not loaded (Player::isProfileLoaded() is false).
+     * Journal records newer than the last checkpoint are then replayed and
+     * checkpointed.
+     */
+    void loadAll();
+
+    /**
+     * @brief Reads the completed words and last game time of one player.
+     * @param player A player from loadAll(); full profiles are left alone.
+     * Unsaved changes of the player are kept.
+     */
+    void loadProfile(Player* player);
+
+    /**
+     * @brief Queues the changed fields of every dirty player for writing.
+     * Returns without touching the disk.
+     */
+    void saveChanges();
+
+    /** @brief Blocks until every queued snapshot and journal record is on disk. */
+    void flush();
+
+    /**
+     * @brief Saves if CheckpointInterval records were journalled since the last save.
+     * Meant to be called after each guess.
+     */
+    void checkpointIfDue();
+
+    /**
+     * @brief Journals points earned by a guess.
+     * @param player The player who guessed.
+     * @param category Category of the word being guessed.
+     * @param points Actual change of the score.
+     */
+    void pointsEarned(Player* player, CategoryEnum category, int points) override;
+
+    /**
+     * @brief Journals a newly completed word.
+     * @param player The player.
+     * @param category Category of the word.
+     * @param position Position of the word in the category's ID list.
+     */
+    void wordCompleted(Player* player, CategoryEnum category, uint32_t position) override;
+};
@@ -0,0 +1,142 @@
+#include "2_Repository/ScoreLeaderboards.h"
+#include <QDate>
+
+/**
+ * @brief Returns the slot of a category in the per-category windows.
+ * @param category The category; out-of-range values map to Unspecified.
+ * @return Index into categories.
+ */
+int ScoreLeaderboards::indexOf(CategoryEnum category) {
+    const int index = static_cast<int>(category);
+    if (index < 0 || index >= CategoryCount) {
+        return static_cast<int>(CategoryEnum::Unspecified);
+    }
+    return index;
+}
+
+/**
+ * @brief Returns today's Julian day number in local time.
+ * @return The day used to bucket points earned now.
+ */
+qint64 ScoreLeaderboards::today() {
+    return QDate::currentDate().toJulianDay();
+}
+
+/**
+ * @brief Records points a player just earned.
+ * @param player The player who earned the points.
+ * @param category Category of the word being guessed.
+ * @param points Points earned; may be negative.
+ * @param day Julian day number the points were earned on.
+ */
+void ScoreLeaderboards::record(Player* player, CategoryEnum category, int points, qint64 day) {
+    restoreBucket(player, ScoreBucket{ day, category, points });
+    categories[indexOf(category)].allTime.add(player, day, points);
+}
+
+/**
+ * @brief Restores a saved daily bucket into the daily and weekly boards.
+ * @param player The player the bucket belongs to.
+ * @param bucket The saved bucket; days outside the window are ignored.
+ */
+void ScoreLeaderboards::restoreBucket(Player* player, const ScoreBucket& bucket) {
+    Windows& scope = categories[indexOf(bucket.category)];
+    overall.daily.add(player, bucket.day, bucket.points);
+    overall.weekly.add(player, bucket.day, bucket.points);
+    scope.daily.add(player, bucket.day, bucket.points);
+    scope.weekly.add(player, bucket.day, bucket.points);
+}
+
+/**
+ * @brief Restores a player's saved all-time total in one category.
+ * @param player The player the total belongs to.
+ * @param category The category.
+ * @param total The saved total.
+ */
+void ScoreLeaderboards::restoreCategoryTotal(Player* player, CategoryEnum category, int total) {
+    categories[indexOf(category)].allTime.add(player, today(), total);
+}
+
+/**
+ * @brief Retires every bucket that is older than the windows ending on a day.
+ * @param day Julian day number of the newest day.
+ */
+void ScoreLeaderboards::advanceTo(qint64 day) {
+    overall.daily.advanceTo(day);
+    overall.weekly.advanceTo(day);
+    for (Windows& scope : categories) {
+        scope.daily.advanceTo(day);
+        scope.weekly.advanceTo(day);
+    }
+}
+
+/**
+ * @brief Returns the board of a period across every category.
+ * @param period Daily or Weekly.
+ * @return The window, or nullptr for AllTime.
+ */
+const ScoreWindow* ScoreLeaderboards::window(LeaderboardPeriod period) const {
+    switch (period) {
+    case LeaderboardPeriod::Daily:  return &overall.daily;
+    case LeaderboardPeriod::Weekly: return &overall.weekly;
+    default:                        return nullptr;
+    }
+}
+
+/**
+ * @brief Returns the board of a period in one category.
+ * @param period The period.
+ * @param category The category.
+ * @return The window.
+ */
+const ScoreWindow* ScoreLeaderboards::window(LeaderboardPeriod period, CategoryEnum category) const {
+    const Windows& scope = categories[indexOf(category)];
+    switch (period) {
+    case LeaderboardPeriod::Daily:  return &scope.daily;
+    case LeaderboardPeriod::Weekly: return &scope.weekly;
+    default:                        return &scope.allTime;
+    }
+}
+
+/**
+ * @brief Returns the buckets of a player that are still inside the weekly window.
+ * @param player The player to look up.
+ * @return The buckets, grouped by category and oldest first.
+ */
+QList<ScoreBucket> ScoreLeaderboards::recentBuckets(const Player* player) const {
+    QList<ScoreBucket> result;
+    for (int i = 0; i < CategoryCount; ++i) {
+        const auto days = categories[i].weekly.bucketsOf(player);
+        for (const auto& day : days) {
+            result.append(ScoreBucket{ day.first, static_cast<CategoryEnum>(i), day.second });
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Removes a player from every board.
+ * @param player The player to remove.
+ */
+void ScoreLeaderboards::remove(const Player* player) {
+    overall.daily.remove(player);
+    overall.weekly.remove(player);
+    for (Windows& scope : categories) {
+        scope.daily.remove(player);
+        scope.weekly.remove(player);
+        scope.allTime.remove(player);
+    }
+}
+
+/**
+ * @brief Drops every recorded point.
+ */
+void ScoreLeaderboards::clear() {
+    overall.daily.clear();
+    overall.weekly.clear();
+    for (Windows& scope : categories) {
+        scope.daily.clear();
+        scope.weekly.clear();
+        scope.allTime.clear();
+    }
+}
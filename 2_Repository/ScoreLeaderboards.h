@@ -0,0 +1,117 @@
+#pragma once
+
+#include <array>
+#include <QList>
+#include "0_Enums/CategoryEnum.h"
+#include "0_Enums/LeaderboardPeriod.h"
+#include "1_Entities/Player.h"
+#include "2_Repository/ScoreWindow.h"
+
+/**
+ * @struct ScoreBucket
+ * @brief Points a player earned in one category on one day.
+ */
+struct ScoreBucket {
+    qint64 day;             ///< Julian day number
+    CategoryEnum category;  ///< Category the points were earned in
+    int points;             ///< Points earned; may be negative
+};
+
+/**
+ * @class ScoreLeaderboards
+ * @brief Daily, weekly and per-category leaderboards fed by score events.
+ *
+ * Every point a player earns is recorded once, with its category and day,
+ * into a daily and a weekly ScoreWindow for all categories and for the
+ * event's own category, plus an all-time window for the category. Each
+ * window keeps its own ranked index, so "top this week in Movies" is a
+ * walk over an existing ranking rather than a scan of past sessions.
+ *
+ * The all-time board over every category is the lifetime score kept by
+ * PlayerRepository and is not duplicated here.
+ */
+class ScoreLeaderboards {
+private:
+    /** @brief Windows ranking the points of one scope. */
+    struct Windows {
+        ScoreWindow daily{1};    ///< Today only
+        ScoreWindow weekly{7};   ///< Today and the six days before
+        ScoreWindow allTime{0};  ///< Never retired (unused for the overall scope)
+    };
+
+    Windows overall;
+    ///< Points across every category.
+
+    std::array<Windows, CategoryCount> categories;
+    ///< Points per category, indexed by CategoryEnum.
+
+    static int indexOf(CategoryEnum category);
+
+public:
+    /**
+     * @brief Returns today's Julian day number in local time.
+     * @return The day used to bucket points earned now.
+     */
+    static qint64 today();
+
+    /**
+     * @brief Records points a player just earned.
+     * @param player The player who earned the points.
+     * @param category Category of the word being guessed.
+     * @param points Points earned; may be negative.
+     * @param day Julian day number the points were earned on.
+     */
+    void record(Player* player, CategoryEnum category, int points, qint64 day = today());
+
+    /**
+     * @brief Restores a saved daily bucket into the daily and weekly boards.
+     * @param player The player the bucket belongs to.
+     * @param bucket The saved bucket; days outside the window are ignored.
+     */
+    void restoreBucket(Player* player, const ScoreBucket& bucket);
+
+    /**
+     * @brief Restores a player's saved all-time total in one category.
+     * @param player The player the total belongs to.
+     * @param category The category.
+     * @param total The saved total.
+     */
+    void restoreCategoryTotal(Player* player, CategoryEnum category, int total);
+
+    /**
+     * @brief Retires every bucket that is older than the windows ending on a day.
+     * @param day Julian day number of the newest day.
+     */
+    void advanceTo(qint64 day);
+
+    /**
+     * @brief Returns the board of a period across every category.
+     * @param period Daily or Weekly.
+     * @return The window, or nullptr for AllTime (use the lifetime ranking).
+     */
+    const ScoreWindow* window(LeaderboardPeriod period) const;
+
+    /**
+     * @brief Returns the board of a period in one category.
+     * @param period The period.
+     * @param category The category.
+     * @return The window.
+     */
+    const ScoreWindow* window(LeaderboardPeriod period, CategoryEnum category) const;
+
+    /**
+     * @brief Returns the buckets of a player that are still inside the weekly window.
+     * @param player The player to look up.
+     * @return The buckets, grouped by category and oldest first.
+     */
+    QList<ScoreBucket> recentBuckets(const Player* player) const;
+
+    /**
+     * @brief Removes a player from every board.
+     * @param player The player to remove.
+     */
+    void remove(const Player* player);
+
+    /** @brief Drops every recorded point. */
+    void clear();
+};
@@ -0,0 +1,125 @@
+#include "2_Repository/ScoreWindow.h"
+#include <limits>
+
+/**
+ * @brief Creates an empty window.
+ * @param bucketCount Number of days kept, or 0 to keep every point forever.
+ */
+ScoreWindow::ScoreWindow(int bucketCount)
+    : bucketCount(bucketCount), currentDay(std::numeric_limits<qint64>::min()) {}
+
+/**
+ * @brief Changes a player's total and repositions it in the ranking.
+ * @param player The player whose total changes.
+ * @param points Points to add; may be negative.
+ *
+ * A player whose total drops back to zero leaves the ranking, so a
+ * board only lists players who were active inside the window.
+ */
+void ScoreWindow::applyPoints(Player* player, int points) {
+    int& total = totals[player];
+    total += points;
+
+    if (total == 0) {
+        totals.remove(player);
+        ranking.remove(player);
+    } else {
+        ranking.update(player, total);
+    }
+}
+
+/**
+ * @brief Adds points earned by a player on a day.
+ * @param player The player who earned the points.
+ * @param day Julian day number the points were earned on.
+ * @param points Points to add; may be negative.
+ */
+void ScoreWindow::add(Player* player, qint64 day, int points) {
+    if (!player || points == 0) return;
+
+    if (bucketCount > 0) {
+        advanceTo(day);
+        if (day <= currentDay - bucketCount) return;
+
+        int& bucketPoints = buckets[day][player];
+        bucketPoints += points;
+        if (bucketPoints == 0) {
+            buckets[day].remove(player);
+        }
+    }
+    applyPoints(player, points);
+}
+
+/**
+ * @brief Moves the window forward so that it ends on a day.
+ * @param day Julian day number of the newest day in the window.
+ *
+ * Each retired bucket costs one ranking update per player in that
+ * bucket, independent of how much history the window has seen.
+ */
+void ScoreWindow::advanceTo(qint64 day) {
+    if (bucketCount == 0 || day <= currentDay) return;
+    currentDay = day;
+
+    const qint64 oldestKept = currentDay - bucketCount + 1;
+    while (!buckets.isEmpty() && buckets.firstKey() < oldestKept) {
+        const QHash<Player*, int> retired = buckets.take(buckets.firstKey());
+        for (auto it = retired.constBegin(); it != retired.constEnd(); ++it) {
+            applyPoints(it.key(), -it.value());
+        }
+    }
+}
+
+/**
+ * @brief Returns a player's total inside the window.
+ * @param player The player to look up.
+ * @return The total, or 0 if the player earned nothing in the window.
+ */
+int ScoreWindow::scoreOf(const Player* player) const {
+    return totals.value(player, 0);
+}
+
+/**
+ * @brief Returns the players ranked by their window total.
+ * @return Reference to the ranking.
+ */
+const PlayerRanking& ScoreWindow::getRanking() const {
+    return ranking;
+}
+
+/**
+ * @brief Returns the live buckets of a player, oldest first.
+ * @param player The player to look up.
+ * @return Pairs of Julian day number and points earned on that day.
+ */
+QList<QPair<qint64, int>> ScoreWindow::bucketsOf(const Player* player) const {
+    QList<QPair<qint64, int>> result;
+    for (auto it = buckets.constBegin(); it != buckets.constEnd(); ++it) {
+        const int points = it.value().value(const_cast<Player*>(player), 0);
+        if (points != 0) {
+            result.append(qMakePair(it.key(), points));
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Removes a player from every bucket and from the ranking.
+ * @param player The player to remove.
+ */
+void ScoreWindow::remove(const Player* player) {
+    for (auto it = buckets.begin(); it != buckets.end(); ++it) {
+        it.value().remove(const_cast<Player*>(player));
+    }
+    totals.remove(player);
+    ranking.remove(player);
+}
+
+/**
+ * @brief Drops every bucket and total.
+ */
+void ScoreWindow::clear() {
+    buckets.clear();
+    totals.clear();
+    ranking.clear();
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QPair>
+#include "1_Entities/Player.h"
+#include "2_Repository/PlayerRanking.h"
+
+/**
+ * @class ScoreWindow
+ * @brief Ranked point totals over a rolling window of days.
+ *
+ * Points are aggregated into one bucket per day. The window keeps the
+ * last bucketCount buckets plus a running total per player, so moving
+ * to a new day only subtracts the buckets that fall out of the window
+ * instead of re-adding the whole history. Every total change is pushed
+ * into the window's own PlayerRanking.
+ *
+ * A bucket count of 0 keeps no buckets and never retires points,
+ * which is what an all-time board needs.
+ */
+class ScoreWindow {
+private:
+    int bucketCount;
+    ///< Number of days in the window, or 0 for an unbounded window.
+
+    qint64 currentDay;
+    ///< Newest day seen, as a Julian day number.
+
+    QMap<qint64, QHash<Player*, int>> buckets;
+    ///< Points earned per player, one bucket per day inside the window.
+
+    QHash<const Player*, int> totals;
+    ///< Sum of every live bucket per player.
+
+    PlayerRanking ranking;
+    ///< Players ordered by their window total.
+
+    void applyPoints(Player* player, int points);
+
+public:
+    /**
+     * @brief Creates an empty window.
+     * @param bucketCount Number of days kept, or 0 to keep every point forever.
+     */
+    explicit ScoreWindow(int bucketCount = 0);
+
+    ScoreWindow(const ScoreWindow&) = delete;
+    ScoreWindow& operator=(const ScoreWindow&) = delete;
+
+    /**
+     * @brief Adds points earned by a player on a day.
+     * @param player The player who earned the points.
+     * @param day Julian day number the points were earned on.
+     * @param points Points to add; may be negative.
+     *
+     * Points for a day that already left the window are ignored.
+     */
+    void add(Player* player, qint64 day, int points);
+
+    /**
+     * @brief Moves the window forward so that it ends on a day.
+     * @param day Julian day number of the newest day in the window.
+     *
+     * Buckets older than the window are retired one by one; earlier days are ignored.
+     */
+    void advanceTo(qint64 day);
+
+    /**
+     * @brief Returns a player's total inside the window.
+     * @param player The player to look up.
+     * @return The total, or 0 if the player earned nothing in the window.
+     */
+    int scoreOf(const Player* player) const;
+
+    /**
+     * @brief Returns the players ranked by their window total.
+     * @return Reference to the ranking; players with a zero total are not listed.
+     */
+    const PlayerRanking& getRanking() const;
+
+    /**
+     * @brief Returns the live buckets of a player, oldest first.
+     * @param player The player to look up.
+     * @return Pairs of Julian day number and points earned on that day.
+     */
+    QList<QPair<qint64, int>> bucketsOf(const Player* player) const;
+
+    /**
+     * @brief Removes a player from every bucket and from the ranking.
+     * @param player The player to remove.
+     */
+    void remove(const Player* player);
+
+    /** @brief Drops every bucket and total. */
+    void clear();
+};
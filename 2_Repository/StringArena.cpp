@@ -0,0 +1,56 @@
+#include "2_Repository/StringArena.h"
+#include <algorithm>
+#include <cstring>
+
+/**
+ * @brief Stores a string in the arena, reusing an identical copy if present.
+ * 
+ * @param text The string to intern.
+ * @return A view of the interned copy, valid until clear() is called.
+ * @details
+ * Strings are appended to the current chunk. When it is full a new chunk
+ * is started; strings larger than a chunk get a chunk of their own.
+ */
+std::string_view StringArena::intern(std::string_view text) {
+    auto existing = interned.find(text);
+    if (existing != interned.end()) {
+        return *existing;
+    }
+
+    if (chunks.empty() || chunkCapacity - chunkUsed < text.size()) {
+        chunkCapacity = std::max(ChunkSize, text.size());
+        chunks.emplace_back(new char[chunkCapacity]);
+        chunkUsed = 0;
+    }
+
+    char* dest = chunks.back().get() + chunkUsed;
+    if (!text.empty()) {
+        std::memcpy(dest, text.data(), text.size());
+    }
+    chunkUsed += text.size();
+    totalBytes += text.size();
+
+    std::string_view stored(dest, text.size());
+    interned.insert(stored);
+    return stored;
+}
+
+/**
+ * @brief Releases all stored strings, invalidating every view.
+ */
+void StringArena::clear() {
+    interned.clear();
+    chunks.clear();
+    chunkUsed = 0;
+    chunkCapacity = 0;
+    totalBytes = 0;
+}
+
+/**
+ * @brief Returns the number of bytes stored in the arena.
+ * 
+ * @return Total size of all interned strings.
+ */
+std::size_t StringArena::size() const {
+    return totalBytes;
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @class StringArena
+ * @brief Append-only storage that interns strings in large contiguous chunks.
+ * 
+ * @details
+ * Each distinct string is copied into the arena exactly once and handed
+ * out as a std::string_view. Chunks are never moved or freed until the
+ * arena is cleared, so the returned views stay valid for the arena's
+ * lifetime and can be shared freely by dictionary entries.
+ */
+class StringArena {
+private:
+    /** Size of a regular chunk in bytes */
+    static constexpr std::size_t ChunkSize = 64 * 1024;
+
+    /** Owned storage chunks; only the last one receives new strings */
+    std::vector<std::unique_ptr<char[]>> chunks;
+
+    /** Bytes used in the last chunk */
+    std::size_t chunkUsed = 0;
+
+    /** Capacity of the last chunk */
+    std::size_t chunkCapacity = 0;
+
+    /** Total bytes stored across all chunks */
+    std::size_t totalBytes = 0;
+
+    /** Views of every string stored so far, used for deduplication */
+    std::unordered_set<std::string_view> interned;
+
+public:
+    /** Default constructor */
+    StringArena() = default;
+
+    /** The arena owns its chunks and cannot be copied */
+    StringArena(const StringArena&) = delete;
+    StringArena& operator=(const StringArena&) = delete;
+
+    /**
+     * @brief Stores a string in the arena, reusing an identical copy if present.
+     * 
+     * @param text The string to intern.
+     * @return A view of the interned copy, valid until clear() is called.
+     */
+    std::string_view intern(std::string_view text);
+
+    /**
+     * @brief Releases all stored strings, invalidating every view.
+     */
+    void clear();
+
+    /**
+     * @brief Returns the number of bytes stored in the arena.
+     * 
+     * @return Total size of all interned strings.
+     */
+    std::size_t size() const;
+};
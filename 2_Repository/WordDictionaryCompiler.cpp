@@ -0,0 +1,148 @@
+#include "2_Repository/WordDictionaryCompiler.h"
+#include "2_Repository/Crc32c.h"
+#include "2_Repository/WordDictionaryFormat.h"
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <QByteArray>
+#include <QSaveFile>
+#include <QString>
+#include <QtEndian>
+#include <QDebug>
+
+namespace {
+
+/** Appends a little-endian integer to the buffer */
+template <typename T>
+void appendLE(QByteArray& buffer, T value) {
+    char bytes[sizeof(T)];
+    qToLittleEndian<T>(value, bytes);
+    buffer.append(bytes, sizeof(T));
+}
+
+/** Overwrites a little-endian 32-bit integer at the given offset */
+void writeLE32(QByteArray& buffer, uint32_t offset, uint32_t value) {
+    qToLittleEndian<quint32>(value, buffer.data() + offset);
+}
+
+} // namespace
+
+/**
+ * @brief Writes every word of a repository to a binary dictionary image.
+ * 
+ * Words are grouped by category (keeping their relative order) so each
+ * category maps to one contiguous ID range. Identical words share a single
+ * copy in the string table. Words longer than the record format allows are
+ * skipped with a warning.
+ * 
+ * The image is written through QSaveFile, so an existing image is only
+ * replaced once the new one is completely on disk.
+ * 
+ * @param source The repository to read words from.
+ * @param outputFile Path of the image to write.
+ * @return true if the image was written successfully, false otherwise.
+ */
+bool WordDictionaryCompiler::compile(IWordRepository& source, const std::string& outputFile) {
+    using namespace WordDictionaryFormat;
+
+    const int categoryCount = CategoryCount;
+
+    // Bucket entries by category
+    std::vector<std::vector<const DictionaryEntry*>> byCategory(categoryCount);
+    int skipped = 0;
+    for (const DictionaryEntry& entry : source.getAllWords()) {
+        if (entry.getWord().size() > MaxWordLength) {
+            skipped++;
+            continue;
+        }
+        byCategory[static_cast<int>(entry.getCategory())].push_back(&entry);
+    }
+    if (skipped > 0) {
+        qWarning() << "Skipped" << skipped << "word(s) longer than" << MaxWordLength << "bytes";
+    }
+
+    uint32_t wordCount = 0;
+    for (const auto& bucket : byCategory) wordCount += static_cast<uint32_t>(bucket.size());
+
+    const uint32_t categoryTable = HeaderSize;
+    const uint32_t recordTable = categoryTable + categoryCount * CategoryEntrySize;
+    const uint32_t stringTable = recordTable + wordCount * RecordSize;
+
+    QByteArray image;
+    image.reserve(static_cast<int>(stringTable));
+
+    // Header; the string table size is patched in at the end
+    image.append(Magic, sizeof(Magic));
+    appendLE<quint32>(image, Version);
+    appendLE<quint32>(image, wordCount);
+    appendLE<quint32>(image, static_cast<quint32>(categoryCount));
+    appendLE<quint32>(image, categoryTable);
+    appendLE<quint32>(image, recordTable);
+    appendLE<quint32>(image, stringTable);
+    appendLE<quint32>(image, 0);
+    appendLE<quint32>(image, 0);   // Checksum fields are patched in at the end
+    appendLE<quint32>(image, 0);
+    appendLE<quint32>(image, 0);
+    appendLE<quint32>(image, 0);
+
+    // Category table
+    uint32_t firstId = 0;
+    for (const auto& bucket : byCategory) {
+        appendLE<quint32>(image, firstId);
+        appendLE<quint32>(image, static_cast<quint32>(bucket.size()));
+        firstId += static_cast<uint32_t>(bucket.size());
+    }
+
+    // Record table, building the deduplicated string table alongside
+    QByteArray strings;
+    std::unordered_map<std::string_view, uint32_t> stringOffsets;
+    for (int category = 0; category < categoryCount; ++category) {
+        for (const DictionaryEntry* entry : byCategory[category]) {
+            std::string_view word = entry->getWord();
+            auto inserted = stringOffsets.emplace(word, static_cast<uint32_t>(strings.size()));
+            if (inserted.second) {
+                strings.append(word.data(), static_cast<int>(word.size()));
+            }
+
+            appendLE<quint32>(image, inserted.first->second);
+            appendLE<quint16>(image, static_cast<quint16>(word.size()));
+            appendLE<quint8>(image, static_cast<quint8>(category));
+            appendLE<quint8>(image, 0);
+            appendLE<quint32>(image, entry->getLetterMask());
+        }
+    }
+
+    writeLE32(image, StringTableSizeOffset, static_cast<uint32_t>(strings.size()));
+    image.append(strings);
+
+    // Checksum table over everything after the header
+    const uint32_t checksumTable = static_cast<uint32_t>(image.size());
+    QByteArray checksums;
+    uint32_t blockCount = 0;
+    for (uint32_t offset = HeaderSize; offset < checksumTable; offset += ChecksumBlockSize) {
+        const uint32_t length = std::min(ChecksumBlockSize, checksumTable - offset);
+        appendLE<quint32>(checksums, Crc32c::compute(image.constData() + offset, length));
+        blockCount++;
+    }
+    image.append(checksums);
+    writeLE32(image, ChecksumTableOffset, checksumTable);
+    writeLE32(image, ChecksumBlockCountOffset, blockCount);
+    writeLE32(image, ChecksumTableCrcOffset, Crc32c::compute(checksums.constData(), checksums.size()));
+    writeLE32(image, HeaderCrcOffset, Crc32c::compute(image.constData(), HeaderCrcOffset));
+
+    QSaveFile file(QString::fromStdString(outputFile));
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Could not write dictionary image:" << file.fileName();
+        return false;
+    }
+    file.write(image);
+    if (!file.commit()) {
+        qWarning() << "Could not write dictionary image:" << file.fileName();
+        return false;
+    }
+
+    qDebug() << "Compiled" << wordCount << "words into" << file.fileName();
+    return true;
+}
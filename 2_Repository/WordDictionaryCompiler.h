@@ -0,0 +1,25 @@
+#pragma once
+#include <string>
+#include "2_Repository/IWordRepository.h"
+
+/**
+ * @class WordDictionaryCompiler
+ * @brief Compiles a word repository into a binary dictionary image (.wgd).
+ * 
+ * @details
+ * The image contains a string table, per-category ID ranges, word lengths
+ * and letter masks (see WordDictionaryFormat.h). It is meant to be built
+ * offline, e.g. from words.txt, and served by WordRepositoryBinary without
+ * any parsing at startup.
+ */
+class WordDictionaryCompiler {
+public:
+    /**
+     * @brief Writes every word of a repository to a binary dictionary image.
+     * 
+     * @param source The repository to read words from.
+     * @param outputFile Path of the image to write.
+     * @return true if the image was written successfully, false otherwise.
+     */
+    static bool compile(IWordRepository& source, const std::string& outputFile);
+};
@@ -0,0 +1,66 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * @file WordDictionaryFormat.h
+ * @brief Layout of the compiled binary dictionary (.wgd) image.
+ * 
+ * @details
+ * All integers are little-endian. The image is laid out as:
+ * 
+ *   Header         HeaderSize bytes (see the offsets below)
+ *   Category table categoryCount x { firstId u32, count u32 }
+ *   Record table   wordCount x { stringOffset u32, length u16,
+ *                                category u8, reserved u8, letterMask u32 }
+ *   String table   the word texts, back to back, not NUL-terminated
+ *   Checksum table blockCount x { crc u32 }
+ * 
+ * Records are grouped by category, so the words of a category form the
+ * contiguous ID range described by its category table entry.
+ * 
+ * Everything between the header and the checksum table is covered by
+ * CRC32C checksums of ChecksumBlockSize-byte blocks (the last one may be
+ * shorter). The header carries the checksum of the checksum table and,
+ * in its last field, the checksum of the header bytes before it.
+ */
+namespace WordDictionaryFormat {
+
+/** File signature found at offset 0 */
+constexpr char Magic[4] = { 'W', 'G', 'D', '\x1A' };
+
+/** Current format version */
+constexpr uint32_t Version = 2;
+
+/** Header field offsets */
+constexpr uint32_t VersionOffset = 4;
+constexpr uint32_t WordCountOffset = 8;
+constexpr uint32_t CategoryCountOffset = 12;
+constexpr uint32_t CategoryTableOffset = 16;
+constexpr uint32_t RecordTableOffset = 20;
+constexpr uint32_t StringTableOffset = 24;
+constexpr uint32_t StringTableSizeOffset = 28;
+constexpr uint32_t ChecksumTableOffset = 32;
+constexpr uint32_t ChecksumBlockCountOffset = 36;
+constexpr uint32_t ChecksumTableCrcOffset = 40;
+constexpr uint32_t HeaderCrcOffset = 44;
+
+/** Size of the fixed header */
+constexpr uint32_t HeaderSize = 48;
+
+/** Bytes covered by one checksum table entry */
+constexpr uint32_t ChecksumBlockSize = 64 * 1024;
+
+/** Size of one category table entry */
+constexpr uint32_t CategoryEntrySize = 8;
+
+/** Size of one word record and the offsets of its fields */
+constexpr uint32_t RecordSize = 12;
+constexpr uint32_t RecordStringOffset = 0;
+constexpr uint32_t RecordLength = 4;
+constexpr uint32_t RecordCategory = 6;
+constexpr uint32_t RecordLetterMask = 8;
+
+/** Longest word a record can describe */
+constexpr uint32_t MaxWordLength = 0xFFFF;
+
+} // namespace WordDictionaryFormat
@@ -0,0 +1,251 @@
+#include "2_Repository/WordRepositoryBinary.h"
+#include "2_Repository/Crc32c.h"
+#include "2_Repository/WordDictionaryFormat.h"
+#include <algorithm>
+#include <cstring>
+#include <QString>
+#include <QtEndian>
+#include <QDebug>
+
+using namespace WordDictionaryFormat;
+
+/**
+ * @brief Opens a compiled dictionary image.
+ * 
+ * If the image is missing or invalid the repository starts empty.
+ * 
+ * @param file The path of the .wgd image.
+ * @param seed Seed for random word selection.
+ */
+WordRepositoryBinary::WordRepositoryBinary(const std::string& file, uint64_t seed)
+    : imageFile(QString::fromStdString(file)), random(seed) {
+    if (!openImage()) {
+        qWarning() << "Could not open dictionary image:" << imageFile.fileName();
+        image = nullptr;
+        imageWordCount = 0;
+        categoryTableCount = 0;
+    }
+}
+
+/**
+ * @brief Unmaps the image.
+ */
+WordRepositoryBinary::~WordRepositoryBinary() {
+    if (image) imageFile.unmap(const_cast<uchar*>(image));
+}
+
+/**
+ * @brief Maps the image and validates its header and table bounds.
+ * 
+ * The header, the checksum table and the category table are verified
+ * against their checksums; records and strings are verified and read on
+ * demand.
+ * 
+ * @return true if the image is usable, false otherwise.
+ */
+bool WordRepositoryBinary::openImage() {
+    if (!imageFile.open(QIODevice::ReadOnly)) return false;
+
+    const qint64 size = imageFile.size();
+    if (size < HeaderSize) return false;
+
+    image = imageFile.map(0, size);
+    if (!image) return false;
+
+    auto read32 = [this](uint32_t offset) { return qFromLittleEndian<quint32>(image + offset); };
+
+    if (std::memcmp(image, Magic, sizeof(Magic)) != 0) return false;
+    if (read32(VersionOffset) != Version) return false;
+    if (read32(HeaderCrcOffset) != Crc32c::compute(image, HeaderCrcOffset)) return false;
+
+    imageWordCount = read32(WordCountOffset);
+    recordTable = read32(RecordTableOffset);
+    stringTable = read32(StringTableOffset);
+    stringTableSize = read32(StringTableSizeOffset);
+    categoryTable = read32(CategoryTableOffset);
+    categoryTableCount = read32(CategoryCountOffset);
+    checksumTable = read32(ChecksumTableOffset);
+    const quint32 blockCount = read32(ChecksumBlockCountOffset);
+
+    // The checksum table must fit and describe exactly the data before it
+    const quint64 fileSize = static_cast<quint64>(size);
+    if (checksumTable < HeaderSize
+        || quint64(checksumTable) + quint64(blockCount) * 4 > fileSize
+        || blockCount != (quint64(checksumTable) - HeaderSize + ChecksumBlockSize - 1) / ChecksumBlockSize
+        || read32(ChecksumTableCrcOffset) != Crc32c::compute(image + checksumTable, quint64(blockCount) * 4)) {
+        return false;
+    }
+    blockState.assign(blockCount, 0);
+
+    // Every table must lie inside the checksummed data
+    const quint64 categoryEnd = categoryTable + quint64(categoryTableCount) * CategoryEntrySize;
+    const quint64 recordEnd = recordTable + quint64(imageWordCount) * RecordSize;
+    return categoryEnd <= checksumTable && recordEnd <= checksumTable
+           && quint64(stringTable) + stringTableSize <= checksumTable
+           && verifyRange(categoryTable, categoryEnd - categoryTable);
+}
+
+/**
+ * @brief Checks the blocks covering a byte range against their checksums.
+ * 
+ * @param offset Start of the range in the image.
+ * @param size Length of the range.
+ * @return true if every covering block is intact.
+ */
+bool WordRepositoryBinary::verifyRange(quint64 offset, quint64 size) const {
+    if (size == 0) return true;
+    if (offset < HeaderSize || offset + size > checksumTable) return false;
+
+    const quint64 first = (offset - HeaderSize) / ChecksumBlockSize;
+    const quint64 last = (offset + size - 1 - HeaderSize) / ChecksumBlockSize;
+    for (quint64 block = first; block <= last; ++block) {
+        if (blockState[block] == 0) {
+            const quint64 start = HeaderSize + block * ChecksumBlockSize;
+            const quint64 length = std::min<quint64>(ChecksumBlockSize, checksumTable - start);
+            const quint32 expected = qFromLittleEndian<quint32>(image + checksumTable + block * 4);
+            blockState[block] = Crc32c::compute(image + start, length) == expected ? 1 : 2;
+            if (blockState[block] == 2) {
+                qWarning() << "Damaged block" << block << "in dictionary image:" << imageFile.fileName();
+            }
+        }
+        if (blockState[block] != 1) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Builds the entry for an image record.
+ * 
+ * Records pointing outside the string table or carrying an unknown
+ * category are read as an empty word or as Unspecified respectively.
+ * A record or word in a damaged block reads as an empty, Unspecified word.
+ * 
+ * @param id The entry ID (must be below imageWordCount).
+ * @return The entry, with its text pointing into the mapping.
+ */
+DictionaryEntry WordRepositoryBinary::readEntry(uint32_t id) const {
+    const quint64 recordOffset = recordTable + quint64(id) * RecordSize;
+    if (!verifyRange(recordOffset, RecordSize)) {
+        return DictionaryEntry(id, std::string_view(), CategoryEnum::Unspecified, 0);
+    }
+
+    const uchar* record = image + recordOffset;
+    quint32 offset = qFromLittleEndian<quint32>(record + RecordStringOffset);
+    quint16 length = qFromLittleEndian<quint16>(record + RecordLength);
+    quint8 category = record[RecordCategory];
+    const quint32 letterMask = qFromLittleEndian<quint32>(record + RecordLetterMask);
+
+    if (quint64(offset) + length > stringTableSize
+        || !verifyRange(quint64(stringTable) + offset, length)) {
+        offset = 0;
+        length = 0;
+    }
+    if (category > static_cast<quint8>(CategoryEnum::Unspecified)) {
+        category = static_cast<quint8>(CategoryEnum::Unspecified);
+    }
+
+    std::string_view word(reinterpret_cast<const char*>(image + stringTable + offset), length);
+    return DictionaryEntry(id, word, static_cast<CategoryEnum>(category), letterMask);
+}
+
+/**
+ * @brief Adds a word to the in-memory overlay.
+ * 
+ * The compiled image is read-only; added words live in memory only.
+ * 
+ * @param word The word to add.
+ * @param category The category of the word.
+ */
+void WordRepositoryBinary::addWord(std::string_view word, CategoryEnum category) {
+    uint32_t id = imageWordCount + static_cast<uint32_t>(addedWords.size());
+    addedWords.emplace_back(id, arena.intern(word), category);
+    if (allWordsBuilt) allWords.push_back(addedWords.back());
+    if (categoryIdsBuilt[static_cast<int>(category)]) {
+        categoryIds[static_cast<int>(category)].push_back(id);
+    }
+}
+
+/**
+ * @brief Retrieves a random word from the repository.
+ * 
+ * @return Pointer to a randomly selected entry, or nullptr if empty.
+ */
+const DictionaryEntry* WordRepositoryBinary::getRandomWord() {
+    uint32_t total = imageWordCount + static_cast<uint32_t>(addedWords.size());
+    if (total == 0) return nullptr;
+
+    return getWordById(random.bounded(total));
+}
+
+/**
+ * @brief Retrieves a word by its entry ID.
+ * 
+ * Image entries are built the first time they are requested and kept
+ * for later lookups.
+ * 
+ * @param id The entry ID.
+ * @return Pointer to the entry, or nullptr if the ID is unknown.
+ */
+const DictionaryEntry* WordRepositoryBinary::getWordById(uint32_t id) {
+    if (id >= imageWordCount) {
+        uint32_t index = id - imageWordCount;
+        return index < addedWords.size() ? &addedWords[index] : nullptr;
+    }
+
+    auto found = imageEntries.find(id);
+    if (found == imageEntries.end()) {
+        found = imageEntries.emplace(id, readEntry(id)).first;
+    }
+    return &found->second;
+}
+
+/**
+ * @brief Retrieves the IDs of all words in a category.
+ * 
+ * The image stores each category as one contiguous ID range, so the list
+ * is expanded from the category table without reading any word records.
+ * Ranges reaching past the record table are clipped.
+ * 
+ * @param category The category to look up.
+ * @return Reference to the category's entry IDs.
+ */
+const std::vector<uint32_t>& WordRepositoryBinary::getWordIdsByCategory(CategoryEnum category) {
+    const int index = static_cast<int>(category);
+    std::vector<uint32_t>& ids = categoryIds[index];
+    if (categoryIdsBuilt[index]) return ids;
+
+    if (image && static_cast<uint32_t>(index) < categoryTableCount) {
+        const uchar* entry = image + categoryTable + quint64(index) * CategoryEntrySize;
+        const quint32 firstId = qFromLittleEndian<quint32>(entry);
+        const quint32 count = qFromLittleEndian<quint32>(entry + 4);
+        const quint64 end = std::min<quint64>(quint64(firstId) + count, imageWordCount);
+        for (quint64 id = firstId; id < end; ++id) {
+            ids.push_back(static_cast<uint32_t>(id));
+        }
+    }
+    for (const DictionaryEntry& entry : addedWords) {
+        if (entry.getCategory() == category) ids.push_back(entry.getId());
+    }
+
+    categoryIdsBuilt[index] = true;
+    return ids;
+}
+
+/**
+ * @brief Returns all words in the repository.
+ * 
+ * Builds an entry for every record on first use; prefer getWordById()
+ * when only a few words are needed.
+ * 
+ * @return Reference to every entry, indexed by entry ID.
+ */
+const std::deque<DictionaryEntry>& WordRepositoryBinary::getAllWords() {
+    if (!allWordsBuilt) {
+        for (uint32_t id = 0; id < imageWordCount; ++id) {
+            allWords.push_back(readEntry(id));
+        }
+        allWords.insert(allWords.end(), addedWords.begin(), addedWords.end());
+        allWordsBuilt = true;
+    }
+    return allWords;
+}
@@ -0,0 +1,174 @@
+#pragma once
+#include "2_Repository/IWordRepository.h"
+#include "1_Entities/DictionaryEntry.h"
+#include "2_Repository/StringArena.h"
+#include "1_Entities/RandomGenerator.h"
+#include <array>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <QFile>
+
+/**
+ * @class WordRepositoryBinary
+ * @brief Read-mostly implementation of IWordRepository over a compiled .wgd image.
+ * 
+ * @details
+ * The image produced by WordDictionaryCompiler is memory-mapped and words
+ * are served straight from it: word text is a view into the mapping, and
+ * the category, length and letter mask come from fixed-size records.
+ * Opening the repository only validates the header, the checksum table and
+ * the category table, so startup costs the same for 60 words or 5 million.
+ * Every other checksum block is verified the first time a record or word
+ * inside it is read; entries in a damaged block read as empty words.
+ * 
+ * Words added at runtime are kept in memory after the image's entries and
+ * are not written back; recompile the dictionary to persist them.
+ */
+class WordRepositoryBinary : public IWordRepository {
+private:
+    /** The mapped image file */
+    QFile imageFile;
+
+    /** Start of the mapped image, or nullptr if it could not be opened */
+    const uchar* image = nullptr;
+
+    /** Number of words stored in the image */
+    uint32_t imageWordCount = 0;
+
+    /** Offset of the record table within the image */
+    uint32_t recordTable = 0;
+
+    /** Offset of the string table within the image */
+    uint32_t stringTable = 0;
+
+    /** Size of the string table in bytes */
+    uint32_t stringTableSize = 0;
+
+    /** Offset of the category table within the image */
+    uint32_t categoryTable = 0;
+
+    /** Number of entries in the category table */
+    uint32_t categoryTableCount = 0;
+
+    /** Offset of the checksum table, which is also the end of the covered data */
+    uint32_t checksumTable = 0;
+
+    /** Verification state of each checksum block: 0 unchecked, 1 good, 2 damaged */
+    mutable std::vector<uint8_t> blockState;
+
+    /** Entries built from image records, keyed by entry ID */
+    std::unordered_map<uint32_t, DictionaryEntry> imageEntries;
+
+    /** Storage for the text of words added at runtime */
+    StringArena arena;
+
+    /** Words added at runtime; their IDs follow the image's */
+    std::deque<DictionaryEntry> addedWords;
+
+    /** Every entry, built on the first getAllWords() call */
+    std::deque<DictionaryEntry> allWords;
+
+    /** Whether allWords has been built */
+    bool allWordsBuilt = false;
+
+    /** Entry IDs of each category, built on first lookup of that category */
+    std::array<std::vector<uint32_t>, CategoryCount> categoryIds;
+
+    /** Whether the matching categoryIds list has been built */
+    std::array<bool, CategoryCount> categoryIdsBuilt{};
+
+    /** Generator used to pick random words */
+    RandomGenerator random;
+
+    /**
+     * @brief Maps the image and validates its header and table bounds.
+     * 
+     * @return true if the image is usable, false otherwise.
+     */
+    bool openImage();
+
+    /**
+     * @brief Checks the blocks covering a byte range against their checksums.
+     * 
+     * Each block is checksummed at most once.
+     * 
+     * @param offset Start of the range in the image.
+     * @param size Length of the range.
+     * @return true if every covering block is intact.
+     */
+    bool verifyRange(quint64 offset, quint64 size) const;
+
+    /**
+     * @brief Builds the entry for an image record.
+     * 
+     * @param id The entry ID (must be below imageWordCount).
+     * @return The entry, with its text pointing into the mapping.
+     */
+    DictionaryEntry readEntry(uint32_t id) const;
+
+public:
+    /**
+     * @brief Opens a compiled dictionary image.
+     * 
+     * If the image is missing or invalid the repository starts empty.
+     * 
+     * @param file Path of the .wgd image.
+     * @param seed Seed for random word selection; fixed seeds give reproducible picks.
+     */
+    WordRepositoryBinary(const std::string& file, uint64_t seed = RandomGenerator::randomSeed());
+
+    /** Unmaps the image */
+    ~WordRepositoryBinary() override;
+
+    /**
+     * @brief Returns whether the image was opened and passed validation.
+     */
+    bool isValid() const { return image != nullptr; }
+
+    /**
+     * @brief Adds a word to the in-memory overlay.
+     * 
+     * @param word The word to add.
+     * @param category The category of the word.
+     */
+    void addWord(std::string_view word, CategoryEnum category) override;
+
+    /**
+     * @brief Retrieves a random word from the repository.
+     * 
+     * @return Pointer to a randomly selected entry, or nullptr if empty.
+     */
+    const DictionaryEntry* getRandomWord() override;
+
+    /**
+     * @brief Retrieves a word by its entry ID.
+     * 
+     * @param id The entry ID.
+     * @return Pointer to the entry, or nullptr if the ID is unknown.
+     */
+    const DictionaryEntry* getWordById(uint32_t id) override;
+
+    /**
+     * @brief Retrieves the IDs of all words in a category.
+     * 
+     * The list is expanded from the image's category table on first use,
+     * without reading any word records.
+     * 
+     * @param category The category to look up.
+     * @return Reference to the category's entry IDs.
+     */
+    const std::vector<uint32_t>& getWordIdsByCategory(CategoryEnum category) override;
+
+    /**
+     * @brief Returns all words in the repository.
+     * 
+     * Builds an entry for every record on first use; prefer getWordById()
+     * when only a few words are needed.
+     * 
+     * @return Reference to every entry, indexed by entry ID.
+     */
+    const std::deque<DictionaryEntry>& getAllWords() override;
+};
@@ -1,97 +1,405 @@
 #include "WordRepositoryFile.h"
-#include <fstream>
-#include <sstream>
-#include <cstdlib>
-#include <ctime>
+#include "2_Repository/Crc32c.h"
+#include <cstring>
 #include <QString>
+#include <QFile>
+#include <QSaveFile>
+#include <QByteArray>
+#include <QList>
 #include <QDebug>
 
 /**
  * @brief Constructs the repository and loads words from the specified file.
  * 
- * Seeds the random number generator and calls loadFromFile().
+ * Calls loadFromFile() and opens the journal for new additions. A large
+ * or left-over journal is compacted right away.
  * 
  * @param file The file path where words are stored.
+ * @param seed Seed for random word selection.
  */
-WordRepositoryFile::WordRepositoryFile(const std::string& file) : filename(file) {
-    std::srand(std::time(nullptr)); // Seed random generator
+WordRepositoryFile::WordRepositoryFile(const std::string& file, uint64_t seed)
+    : filename(file), random(seed) {
     loadFromFile();                  // Load words from the file
+    openJournal();
+    if (journalEntries >= CompactionThreshold
+        || QFile::exists(QString::fromStdString(rotatedJournalPath()))) {
+        startCompaction();
+    }
+}
+
+/**
+ * @brief Waits for a running compaction and closes the journal.
+ * 
+ * Journal entries that were not compacted yet stay on disk and are
+ * replayed on the next load.
+ */
+WordRepositoryFile::~WordRepositoryFile() {
+    if (compactor.joinable()) compactor.join();
+    journal.close();
+}
+
+/**
+ * @brief Returns the path of the active journal.
+ * 
+ * @return The word file path with a ".journal" suffix.
+ */
+std::string WordRepositoryFile::journalPath() const {
+    return filename + ".journal";
+}
+
+/**
+ * @brief Returns the path of a rotated journal awaiting compaction.
+ * 
+ * @return The word file path with a ".journal.old" suffix.
+ */
+std::string WordRepositoryFile::rotatedJournalPath() const {
+    return filename + ".journal.old";
 }
 
 /**
  * @brief Loads words from the file into the in-memory list.
  * 
  * Each line in the file should contain a word followed by its category integer.
- * Invalid lines are skipped. Loaded words are printed using qDebug().
+ * The file is memory-mapped and tokenized in place, so no per-line strings
+ * or streams are created. Invalid lines are skipped and reported in a single
+ * summary once loading finishes.
+ * 
+ * Afterwards any rotated journal and the active journal are replayed, in
+ * that order, to recover additions that were not compacted yet.
  */
 void WordRepositoryFile::loadFromFile() {
     words.clear();                   // Clear existing words
-    std::ifstream infile(filename);  // Open file for reading
-    std::string line;
-
-    while (std::getline(infile, line)) {          // Read line by line
-        std::istringstream iss(line);
-        std::string wordStr;
-        int categoryInt;
-
-        if (!(iss >> wordStr >> categoryInt)) continue; // Skip invalid lines
-        qDebug() << "Loaded word:" << QString::fromStdString(wordStr)
-                 << "Category:" << categoryInt;
-        // Create Word object and add to memory
-        words.push_back(Word(wordStr, static_cast<CategoryEnum>(categoryInt)));
+    arena.clear();
+    for (auto& ids : categoryIds) ids.clear();
+
+    loadFile(filename, false);
+    size_t compacted = words.size();
+    loadFile(rotatedJournalPath(), true);
+    loadFile(journalPath(), true);
+    journalEntries = static_cast<int>(words.size() - compacted);
+}
+
+/**
+ * @brief Maps a word or journal file and parses it into entries.
+ * 
+ * @param path The file to read.
+ * @param isJournal Whether the file is a journal (missing files are not an error).
+ */
+void WordRepositoryFile::loadFile(const std::string& path, bool isJournal) {
+    QFile file(QString::fromStdString(path));
+    if (!file.open(QIODevice::ReadOnly)) {
+        if (!isJournal) qWarning() << "Could not open word file:" << file.fileName();
+        return;
+    }
+
+    const qint64 size = file.size();
+    if (size <= 0) return;
+
+    // Map the file; fall back to a single read if mapping is not supported
+    uchar* mapped = file.map(0, size);
+    if (mapped) {
+        parseWords(reinterpret_cast<const char*>(mapped), static_cast<size_t>(size), path, isJournal);
+        file.unmap(mapped);
+    } else {
+        QByteArray content = file.readAll();
+        parseWords(content.constData(), static_cast<size_t>(content.size()), path, isJournal);
+    }
+
+    file.close();  // Close the file
+}
+
+/**
+ * @brief Tokenizes a buffer of "word category" lines into dictionary entries.
+ * 
+ * Tokens are read straight from the buffer; only the word text is copied,
+ * once, into the string arena. Journal lines carry the entry ID as a third
+ * token, so entries that already reached the main file are skipped, and
+ * the CRC32C of the line so far as a fourth; lines failing it are skipped
+ * as malformed. A journal's last line without a newline was cut short by a
+ * crash and is dropped.
+ * 
+ * @param data Start of the file contents.
+ * @param size Number of bytes in the buffer.
+ * @param source Path of the file, used in log messages.
+ * @param isJournal Whether the buffer holds journal lines.
+ */
+void WordRepositoryFile::parseWords(const char* data, size_t size, const std::string& source, bool isJournal) {
+    const char* p = data;
+    const char* end = data + size;
+    auto isBlank = [](char c) { return c == ' ' || c == '\t' || c == '\r'; };
+
+    const size_t loadedBefore = words.size();
+    int lineNumber = 0;
+    int malformedCount = 0;
+    QList<int> malformedLines;       // First few offending line numbers
+
+    while (p < end) {
+        lineNumber++;
+        const char* lineStart = p;
+        const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        if (!lineEnd) {
+            if (isJournal) {
+                qWarning() << "Dropped an incomplete last line of" << QString::fromStdString(source);
+                break;
+            }
+            lineEnd = end;
+        }
+
+        // Word token
+        while (p < lineEnd && isBlank(*p)) ++p;
+        const char* wordStart = p;
+        while (p < lineEnd && !isBlank(*p)) ++p;
+        std::string_view wordStr(wordStart, p - wordStart);
+
+        // Category token
+        while (p < lineEnd && isBlank(*p)) ++p;
+        bool negative = false;
+        if (p < lineEnd && (*p == '-' || *p == '+')) negative = (*p++ == '-');
+        const char* digitsStart = p;
+        int categoryInt = 0;
+        while (p < lineEnd && *p >= '0' && *p <= '9' && categoryInt <= static_cast<int>(CategoryEnum::Unspecified)) {
+            categoryInt = categoryInt * 10 + (*p++ - '0');
+        }
+        if (negative) categoryInt = -categoryInt;
+
+        bool blankLine = wordStr.empty();
+        bool valid = !blankLine && p != digitsStart
+                     && categoryInt >= 0 && categoryInt <= static_cast<int>(CategoryEnum::Unspecified);
+
+        // Journal entry ID; entries below the loaded count were already compacted
+        if (valid && isJournal) {
+            while (p < lineEnd && isBlank(*p)) ++p;
+            const char* idStart = p;
+            size_t id = 0;
+            while (p < lineEnd && *p >= '0' && *p <= '9' && id <= words.size()) {
+                id = id * 10 + (*p++ - '0');
+            }
+            while (p < lineEnd && *p >= '0' && *p <= '9') ++p;   // Digits of an ID past the loaded count
+            const bool hasId = p != idStart;
+
+            // Checksum token; journals written before checksums have none
+            const char* checkedEnd = p;
+            while (p < lineEnd && isBlank(*p)) ++p;
+            if (p < lineEnd) {
+                uint32_t expected = 0;
+                int digits = 0;
+                for (; p < lineEnd && digits < 8; ++p, ++digits) {
+                    const char c = *p;
+                    const int nibble = (c >= '0' && c <= '9') ? c - '0'
+                                     : (c >= 'a' && c <= 'f') ? c - 'a' + 10 : -1;
+                    if (nibble < 0) break;
+                    expected = (expected << 4) | static_cast<uint32_t>(nibble);
+                }
+                valid = digits == 8
+                        && Crc32c::compute(lineStart, static_cast<size_t>(checkedEnd - lineStart)) == expected;
+            }
+
+            if (valid && hasId && id < words.size()) {
+                p = lineEnd < end ? lineEnd + 1 : end;
+                continue;
+            }
+        }
+
+        if (valid) {
+            // Create the dictionary entry and add to memory
+            categoryIds[categoryInt].push_back(static_cast<uint32_t>(words.size()));
+            words.emplace_back(static_cast<uint32_t>(words.size()), arena.intern(wordStr),
+                               static_cast<CategoryEnum>(categoryInt));
+        } else if (!blankLine) {
+            malformedCount++;
+            if (malformedLines.size() < 10) malformedLines.append(lineNumber);
+        }
+
+        p = lineEnd < end ? lineEnd + 1 : end;   // Skip past the newline
+    }
+
+    qDebug() << (isJournal ? "Replayed" : "Loaded") << words.size() - loadedBefore
+             << "words from" << QString::fromStdString(source);
+    if (malformedCount > 0) {
+        qWarning() << "Skipped" << malformedCount << "malformed line(s) in"
+                   << QString::fromStdString(source) << "- first at lines:" << malformedLines;
+    }
+}
+
+/**
+ * @brief Opens the active journal for appending.
+ */
+void WordRepositoryFile::openJournal() {
+    journal.setFileName(QString::fromStdString(journalPath()));
+    if (!journal.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qWarning() << "Could not open word journal:" << journal.fileName();
+    }
+}
+
+/**
+ * @brief Rotates the journal and starts folding it into the main file.
+ * 
+ * The active journal is renamed to the rotated path and a fresh one is
+ * opened, so additions made during compaction are never lost. The main
+ * file is then rewritten from an in-memory snapshot on a background
+ * thread. Replay skips journal entries whose ID is already in the main
+ * file, so entries covered by a snapshot are never loaded twice.
+ * 
+ * This runs on the caller's thread, so it never waits for a compaction
+ * in progress: it returns and leaves journalEntries as it is, and the
+ * next addition tries again.
+ */
+void WordRepositoryFile::startCompaction() {
+    if (compacting) return;
+    if (compactor.joinable()) compactor.join();   // Already finished
+
+    // A rotated journal left by a failed compaction is folded in as it is;
+    // its entries and the active ones are all part of the snapshot below.
+    // A journal that could not even be created has nothing to rotate.
+    const QString rotated = QString::fromStdString(rotatedJournalPath());
+    if (!QFile::exists(rotated) && QFile::exists(QString::fromStdString(journalPath()))) {
+        journal.close();
+        bool rotatedOk = QFile::rename(journal.fileName(), rotated);
+        openJournal();
+        journalEntries = 0;   // On failure, retry only after another full journal
+        if (!rotatedOk) {
+            qWarning() << "Could not rotate word journal:" << journal.fileName();
+            return;
+        }
+    }
+    journalEntries = 0;
+
+    // Word texts live in the arena, which never moves, so views are safe to share
+    std::vector<std::pair<std::string_view, CategoryEnum>> snapshot;
+    snapshot.reserve(words.size());
+    for (const DictionaryEntry& w : words) {
+        snapshot.emplace_back(w.getWord(), w.getCategory());
     }
 
-    infile.close();  // Close the file
+    compacting = true;
+    compactor = std::thread([this, snapshot = std::move(snapshot), rotated = rotatedJournalPath()]() mutable {
+        compact(filename, std::move(snapshot), std::move(rotated));
+        compacting = false;
+    });
 }
 
 /**
- * @brief Saves the in-memory words to the file.
+ * @brief Writes a snapshot of the dictionary over the main file.
+ * 
+ * The file is written through QSaveFile, so it is replaced atomically.
+ * The rotated journal is only removed after the new file is committed;
+ * if anything fails it stays on disk and is replayed on the next load.
  * 
- * Overwrites the existing file content with the current word list.
+ * @param filename The main word file.
+ * @param snapshot Word texts and categories in entry ID order.
+ * @param rotatedJournal The journal whose entries the snapshot includes.
  */
-void WordRepositoryFile::saveToFile() {
-    std::ofstream outfile(filename, std::ios::trunc); // Open file for writing (overwrite)
-    for (auto& w : words) {
-        outfile << w.getWord() << " " << static_cast<int>(w.getCategory()) << std::endl;
+void WordRepositoryFile::compact(std::string filename,
+                                 std::vector<std::pair<std::string_view, CategoryEnum>> snapshot,
+                                 std::string rotatedJournal) {
+    QByteArray content;
+    for (const auto& w : snapshot) {
+        content.append(w.first.data(), static_cast<int>(w.first.size()));
+        content.append(' ');
+        content.append(QByteArray::number(static_cast<int>(w.second)));
+        content.append('\n');
+    }
+
+    QSaveFile outfile(QString::fromStdString(filename));
+    if (!outfile.open(QIODevice::WriteOnly) || outfile.write(content) != content.size()) {
+        outfile.cancelWriting();
+        qWarning() << "Could not write word file:" << QString::fromStdString(filename);
+        return;
+    }
+    if (!outfile.commit()) {
+        qWarning() << "Could not replace word file:" << QString::fromStdString(filename);
+        return;
     }
-    outfile.close(); // Close the file
+    QFile::remove(QString::fromStdString(rotatedJournal));
 }
 
 /**
  * @brief Adds a word to the repository.
  * 
- * Updates the in-memory list and saves changes to the file.
+ * Updates the in-memory list and appends one line to the journal instead
+ * of rewriting the word file. The journal is compacted in the background
+ * once it reaches CompactionThreshold entries. If the journal cannot be
+ * written, the word file is rewritten right away so the word still
+ * reaches the disk; if a compaction is already running, the rewrite is
+ * left to the next addition.
  * 
- * @param word The Word object to add.
+ * @param word The word to add.
+ * @param category The category of the word.
  */
-void WordRepositoryFile::addWord(const Word& word) {
-    words.push_back(word); // Add to memory
-    saveToFile();          // Save updated list to file
+void WordRepositoryFile::addWord(std::string_view word, CategoryEnum category) {
+    uint32_t id = static_cast<uint32_t>(words.size());
+    words.emplace_back(id, arena.intern(word), category); // Add to memory
+    categoryIds[static_cast<int>(category)].push_back(id);
+
+    // Append "word category id crc" to the journal
+    QByteArray line(word.data(), static_cast<int>(word.size()));
+    line.append(' ');
+    line.append(QByteArray::number(static_cast<int>(category)));
+    line.append(' ');
+    line.append(QByteArray::number(id));
+    const QByteArray crc = QByteArray::number(Crc32c::compute(line.constData(), line.size()), 16);
+    line.append(' ');
+    line.append(QByteArray(8 - crc.size(), '0'));
+    line.append(crc);
+    line.append('\n');
+
+    if (!journal.isOpen()) openJournal();
+    if (!journal.isOpen() || journal.write(line) != line.size() || !journal.flush()) {
+        qWarning() << "Could not write word journal:" << journal.fileName() << "- rewriting"
+                   << QString::fromStdString(filename);
+        journal.close();   // Reopened on the next addition
+        journalEntries = CompactionThreshold;   // Retried on the next addition if skipped
+        startCompaction();
+        return;
+    }
+
+    if (++journalEntries >= CompactionThreshold) startCompaction();
 }
+
 /**
  * @brief Retrieves a random word from the repository.
  * 
- * If the repository is empty, returns a Word with an empty string
- * and category set to Unspecified.
+ * If the repository is empty, returns nullptr.
  * 
- * @return A randomly selected Word object from the repository.
+ * @return Pointer to a randomly selected entry from the repository.
  */
-Word WordRepositoryFile::getRandomWord() {
+const DictionaryEntry* WordRepositoryFile::getRandomWord() {
     if (words.empty()) 
-        return Word("", CategoryEnum::Unspecified); // Return empty if no words
+        return nullptr;                            // Return nothing if no words
 
-    int index = rand() % words.size();             // Generate random index
-    return words[index];                           // Return the randomly selected word
+    uint32_t index = random.bounded(static_cast<uint32_t>(words.size())); // Unbiased random index
+    return &words[index];                          // Return the randomly selected word
+}
+
+/**
+ * @brief Retrieves a word by its entry ID.
+ * 
+ * @param id The entry ID.
+ * @return Pointer to the entry, or nullptr if the ID is unknown.
+ */
+const DictionaryEntry* WordRepositoryFile::getWordById(uint32_t id) {
+    if (id >= words.size()) return nullptr;
+    return &words[id];
+}
+
+/**
+ * @brief Retrieves the IDs of all words in a category.
+ * 
+ * @param category The category to look up.
+ * @return Reference to the category's entry IDs, in insertion order.
+ */
+const std::vector<uint32_t>& WordRepositoryFile::getWordIdsByCategory(CategoryEnum category) {
+    return categoryIds[static_cast<int>(category)];
 }
 
 /**
- * @brief Returns a copy of all words in the repository.
+ * @brief Returns all words in the repository.
  * 
- * Provides access to the full list of words currently stored in memory.
- * Modifying the returned vector will not affect the repository.
+ * Provides read-only access to the full list of words currently stored
+ * in memory without copying it.
  * 
- * @return A std::vector containing all Word objects currently stored.
+ * @return Reference to the stored entries, indexed by entry ID.
  */
-std::vector<Word> WordRepositoryFile::getAllWords() {
-    return words; // Return copy of word list
+const std::deque<DictionaryEntry>& WordRepositoryFile::getAllWords() {
+    return words;
 }
@@ -1,8 +1,17 @@
 #pragma once
 #include "2_Repository/IWordRepository.h"
-#include "1_Entities/Word.h"
-#include <vector>
+#include "1_Entities/DictionaryEntry.h"
+#include "2_Repository/StringArena.h"
+#include "1_Entities/RandomGenerator.h"
+#include <array>
+#include <atomic>
+#include <deque>
+#include <string_view>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <QFile>
 
 /**
  * @class WordRepositoryFile
@@ -10,53 +19,158 @@
  * 
  * This class manages words stored in a file. It loads words into memory 
  * at startup and saves changes back to the file.
+ * 
+ * Added words are appended to a journal next to the file ("<file>.journal")
+ * instead of rewriting the whole file. Once enough entries accumulate, the
+ * journal is rotated and a background thread folds it into the main file.
+ * Loading replays any journal left behind, so no addition is lost if the
+ * application stops before compaction.
  */
 class WordRepositoryFile : public IWordRepository {
 private:
     /** The file where words are stored */
     std::string filename;
 
-    /** In-memory list of words */
-    std::vector<Word> words;
+    /** Storage for the text of every word */
+    StringArena arena;
+
+    /** In-memory list of words, indexed by entry ID */
+    std::deque<DictionaryEntry> words;
+
+    /** Entry IDs of each category, indexed by CategoryEnum value */
+    std::array<std::vector<uint32_t>, CategoryCount> categoryIds;
+
+    /** Number of journal entries after which the journal is compacted */
+    static constexpr int CompactionThreshold = 1024;
+
+    /** Open append handle of the journal */
+    QFile journal;
+
+    /** Entries written to the current journal since the last rotation */
+    int journalEntries = 0;
+
+    /** Background thread folding a rotated journal into the main file */
+    std::thread compactor;
+
+    /** Set while the compactor is still writing the main file */
+    std::atomic<bool> compacting{false};
+
+    /** Generator used to pick random words */
+    RandomGenerator random;
 
     /**
-     * @brief Loads words from the file into memory.
+     * @brief Loads words from the file into memory and replays the journal.
      */
     void loadFromFile();
 
     /**
-     * @brief Saves the in-memory words back to the file.
+     * @brief Maps a word or journal file and parses it into entries.
+     * 
+     * @param path The file to read.
+     * @param isJournal Whether the file is a journal (missing files are not an error).
+     */
+    void loadFile(const std::string& path, bool isJournal);
+
+    /**
+     * @brief Tokenizes the file contents in place into dictionary entries.
+     * 
+     * Journal lines carry the entry ID as a third token; entries whose ID
+     * is already loaded are skipped.
+     * 
+     * @param data Start of the file contents.
+     * @param size Number of bytes in the buffer.
+     * @param source Path of the file, used in log messages.
+     * @param isJournal Whether the buffer holds journal lines.
+     */
+    void parseWords(const char* data, size_t size, const std::string& source, bool isJournal);
+
+    /**
+     * @brief Returns the path of the active journal.
+     */
+    std::string journalPath() const;
+
+    /**
+     * @brief Returns the path of a rotated journal awaiting compaction.
      */
-    void saveToFile();
+    std::string rotatedJournalPath() const;
+
+    /**
+     * @brief Opens the active journal for appending.
+     */
+    void openJournal();
+
+    /**
+     * @brief Rotates the journal and starts folding it into the main file.
+     * 
+     * Does nothing while a previous compaction is still running.
+     */
+    void startCompaction();
+
+    /**
+     * @brief Writes a snapshot of the dictionary over the main file.
+     * 
+     * Runs on the compaction thread. The rotated journal is removed once
+     * the new file has been committed.
+     * 
+     * @param filename The main word file.
+     * @param snapshot Word texts and categories in entry ID order.
+     * @param rotatedJournal The journal whose entries the snapshot includes.
+     */
+    static void compact(std::string filename,
+                        std::vector<std::pair<std::string_view, CategoryEnum>> snapshot,
+                        std::string rotatedJournal);
 
 public:
     /**
      * @brief Constructs the repository with a given file.
      * 
      * @param file The file path where words are stored.
+     * @param seed Seed for random word selection; fixed seeds give reproducible picks.
      */
-    WordRepositoryFile(const std::string& file);
+    WordRepositoryFile(const std::string& file, uint64_t seed = RandomGenerator::randomSeed());
+
+    /**
+     * @brief Waits for a running compaction and closes the journal.
+     */
+    ~WordRepositoryFile() override;
 
     /**
      * @brief Adds a word to the repository.
      * 
-     * This updates the in-memory list and saves the change to the file.
+     * This updates the in-memory list and appends the change to the journal.
      * 
-     * @param word The Word object to add.
+     * @param word The word to add.
+     * @param category The category of the word.
      */
-    void addWord(const Word& word) override;
+    void addWord(std::string_view word, CategoryEnum category) override;
 
     /**
      * @brief Retrieves a random word from the repository.
      * 
-     * @return A randomly selected Word object.
+     * @return Pointer to a randomly selected entry, or nullptr if empty.
+     */
+    const DictionaryEntry* getRandomWord() override;
+
+    /**
+     * @brief Retrieves a word by its entry ID.
+     * 
+     * @param id The entry ID.
+     * @return Pointer to the entry, or nullptr if the ID is unknown.
+     */
+    const DictionaryEntry* getWordById(uint32_t id) override;
+
+    /**
+     * @brief Retrieves the IDs of all words in a category.
+     * 
+     * @param category The category to look up.
+     * @return Reference to the category's entry IDs, in insertion order.
      */
-    Word getRandomWord() override;
+    const std::vector<uint32_t>& getWordIdsByCategory(CategoryEnum category) override;
 
     /**
      * @brief Returns all words in the repository.
      * 
-     * @return A vector containing all Word objects.
+     * @return Reference to the stored entries, indexed by entry ID.
      */
-    std::vector<Word> getAllWords() override;
+    const std::deque<DictionaryEntry>& getAllWords() override;
 };
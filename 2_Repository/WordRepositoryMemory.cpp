@@ -1,46 +1,76 @@
 #include "2_Repository/WordRepositoryMemory.h"
-#include <cstdlib>
 #include <stdexcept>
 
+/**
+ * @brief Constructs an empty repository.
+ * 
+ * @param seed Seed for random word selection.
+ */
+WordRepositoryMemory::WordRepositoryMemory(uint64_t seed) : random(seed) {}
+
 /**
  * @brief Adds a word to the in-memory repository.
  * 
- * @param word The Word object to add.
+ * @param word The word to add.
+ * @param category The category of the word.
  * @details
  * This repository only stores words in memory and does not persist them.
  * Useful for dynamic word addition at runtime, for testing, or temporary sessions.
  */
-void WordRepositoryMemory::addWord(const Word& word) {
-    words.push_back(word);
+void WordRepositoryMemory::addWord(std::string_view word, CategoryEnum category) {
+    uint32_t id = static_cast<uint32_t>(words.size());
+    words.emplace_back(id, arena.intern(word), category);
+    categoryIds[static_cast<int>(category)].push_back(id);
 }
 
 /**
  * @brief Selects a random word from the in-memory repository.
  * 
- * @return A randomly selected Word object.
+ * @return Pointer to a randomly selected entry.
  * @throws std::runtime_error if the word list is empty.
  * @details
  * Since this repository is in-memory, it provides quick access to words
  * without reading from a file. Ideal for scenarios where words are
  * dynamically generated or temporarily stored.
  */
-Word WordRepositoryMemory::getRandomWord() {
+const DictionaryEntry* WordRepositoryMemory::getRandomWord() {
     if (words.empty()) {
         throw std::runtime_error("Word list is empty!");
     }
 
-    int index = rand() % words.size();
-    return words[index];
+    uint32_t index = random.bounded(static_cast<uint32_t>(words.size()));
+    return &words[index];
+}
+
+/**
+ * @brief Retrieves a word by its entry ID.
+ * 
+ * @param id The entry ID.
+ * @return Pointer to the entry, or nullptr if the ID is unknown.
+ */
+const DictionaryEntry* WordRepositoryMemory::getWordById(uint32_t id) {
+    if (id >= words.size()) return nullptr;
+    return &words[id];
+}
+
+/**
+ * @brief Retrieves the IDs of all words in a category.
+ * 
+ * @param category The category to look up.
+ * @return Reference to the category's entry IDs, in insertion order.
+ */
+const std::vector<uint32_t>& WordRepositoryMemory::getWordIdsByCategory(CategoryEnum category) {
+    return categoryIds[static_cast<int>(category)];
 }
 
 /**
  * @brief Returns all words stored in memory.
  * 
- * @return A vector containing all Word objects.
+ * @return Reference to the stored entries, indexed by entry ID.
  * @details
- * This allows inspection of all dynamically added words. 
+ * This allows inspection of all dynamically added words without copying.
  * The list is volatile and will be lost when the program ends.
  */
-std::vector<Word> WordRepositoryMemory::getAllWords() {
+const std::deque<DictionaryEntry>& WordRepositoryMemory::getAllWords() {
     return words;
 }
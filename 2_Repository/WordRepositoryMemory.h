@@ -1,7 +1,12 @@
 #pragma once
 
 #include "2_Repository/IWordRepository.h"
-#include "1_Entities/Word.h"
+#include "1_Entities/DictionaryEntry.h"
+#include "2_Repository/StringArena.h"
+#include "1_Entities/RandomGenerator.h"
+#include <array>
+#include <deque>
+#include <string_view>
 #include <vector>
 
 /**
@@ -18,31 +23,61 @@
  */
 class WordRepositoryMemory : public IWordRepository {
 private:
-    /** In-memory list of words */
-    std::vector<Word> words;
+    /** Storage for the text of every word */
+    StringArena arena;
+
+    /** In-memory list of words, indexed by entry ID */
+    std::deque<DictionaryEntry> words;
+
+    /** Entry IDs of each category, indexed by CategoryEnum value */
+    std::array<std::vector<uint32_t>, CategoryCount> categoryIds;
+
+    /** Generator used to pick random words */
+    RandomGenerator random;
 
 public:
-    /** Default constructor */
-    WordRepositoryMemory() = default;
+    /**
+     * @brief Constructs an empty repository.
+     * 
+     * @param seed Seed for random word selection; fixed seeds give reproducible picks.
+     */
+    explicit WordRepositoryMemory(uint64_t seed = RandomGenerator::randomSeed());
 
     /**
      * @brief Adds a word to the in-memory repository.
      * 
-     * @param word The Word object to add.
+     * @param word The word to add.
+     * @param category The category of the word.
      */
-    void addWord(const Word& word) override;
+    void addWord(std::string_view word, CategoryEnum category) override;
 
     /**
      * @brief Retrieves a random word from the in-memory repository.
      * 
-     * @return A randomly selected Word object.
+     * @return Pointer to a randomly selected entry.
+     */
+    const DictionaryEntry* getRandomWord() override;
+
+    /**
+     * @brief Retrieves a word by its entry ID.
+     * 
+     * @param id The entry ID.
+     * @return Pointer to the entry, or nullptr if the ID is unknown.
+     */
+    const DictionaryEntry* getWordById(uint32_t id) override;
+
+    /**
+     * @brief Retrieves the IDs of all words in a category.
+     * 
+     * @param category The category to look up.
+     * @return Reference to the category's entry IDs, in insertion order.
      */
-    Word getRandomWord() override;
+    const std::vector<uint32_t>& getWordIdsByCategory(CategoryEnum category) override;
 
     /**
      * @brief Returns all words in the in-memory repository.
      * 
-     * @return A vector containing all Word objects.
+     * @return Reference to the stored entries, indexed by entry ID.
      */
-    std::vector<Word> getAllWords() override;
+    const std::deque<DictionaryEntry>& getAllWords() override;
 };
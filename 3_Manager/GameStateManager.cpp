@@ -9,20 +9,30 @@
 #include <QDebug>
 
 /**
- * @brief Constructs the GameStateManager and attempts to load the last saved session.
+ * @brief Constructs the GameStateManager.
  * @param repository Pointer to the GameStateRepository for data persistence.
  * @param wordManager Pointer to the WordManager for word and scoring logic.
  */
 GameStateManager::GameStateManager(GameStateRepository* repository, WordManager* wordManager)
     : m_repository(repository), m_wordManager(wordManager), m_currentGameState(nullptr) {
-    loadLastGame();
 }
 
 /**
- * @brief Cleans up resources used by the GameStateManager.
+ * @brief Records a running game as abandoned and frees it.
  */
 GameStateManager::~GameStateManager() {
-    // Memory management: delete m_currentGameState; could be added here if needed
+    saveCurrentGame();
+    delete m_currentGameState;
+}
+
+/**
+ * @brief Sets the player whose games are recorded.
+ * @param playerName Name of the player.
+ */
+void GameStateManager::setPlayer(const QString& playerName) {
+    if (playerName == m_playerName) return;
+    saveCurrentGame();
+    m_playerName = playerName;
 }
 
 /**
@@ -30,17 +40,25 @@ GameStateManager::~GameStateManager() {
  * @param categoryName The name of the word category as a QString.
  */
 void GameStateManager::startNewGame(QString categoryName) {
+    // The previous game ends here; if it was still running it was abandoned
+    saveCurrentGame();
+
+    // The previous game's session ends with the draw, so its state goes first
+    delete m_currentGameState;
+    m_currentGameState = nullptr;
+
     // Transition from Qt QString to standard C++ string for backend logic
     m_wordManager->startNewGame(categoryName.toStdString());
-    Word* selectedWord = m_wordManager->getCurrentWord();
+    GuessSession* selectedSession = m_wordManager->getCurrentSession();
 
-    if (selectedWord == nullptr) {
+    if (selectedSession == nullptr) {
         qDebug() << "Error: Word could not be selected.";
         return;
     }
 
     // Create a new game state with a 180-second time limit
-    m_currentGameState = new GameState(selectedWord, 180);
+    m_currentGameState = new GameState(selectedSession, 180);
+    m_currentGameSaved = false;
     m_currentGameState->startTimer();
 }
 
@@ -71,22 +89,29 @@ void GameStateManager::makeGuess(QChar letter) {
 }
 
 /**
- * @brief Saves the current active game state to the repository.
+ * @brief Records the current game session in the history, once.
+ * * The outcome comes from the game state; a game that is not over is
+ * recorded as abandoned.
  */
 void GameStateManager::saveCurrentGame() {
-    if (m_currentGameState && !m_currentGameState->isGameOver()) {
-        m_repository->saveGameState(m_currentGameState);
-    }
-}
+    if (!m_currentGameState || m_currentGameSaved || !m_repository) return;
+    m_currentGameSaved = true;
 
-/**
- * @brief Loads the most recently saved game session from the repository.
- */
-void GameStateManager::loadLastGame() {
-    GameState* lastGame = m_repository->getLastGameState();
-    if (lastGame) {
-        m_currentGameState = lastGame;
-    }
+    GuessSession* session = m_currentGameState->getCurrentSession();
+    if (!session || m_playerName.isEmpty()) return;
+
+    m_currentGameState->endTimer();
+
+    GameRecord record;
+    record.startTime = m_currentGameState->getStartTime().toSecsSinceEpoch();
+    record.player = m_playerName;
+    record.wordId = session->getEntryId();
+    record.category = session->getCategory();
+    record.outcome = m_currentGameState->getOutcome();
+    record.guesses = session->getGuessCount();
+    record.misses = session->getIncorrectGuesses();
+    record.durationSeconds = m_currentGameState->getElapsedTime();
+    m_repository->saveGame(record);
 }
 
 /**
@@ -11,7 +11,7 @@
 #include "1_Entities/GameState.h"
 #include "2_Repository/GameStateRepository.h"
 #include "3_Manager/WordManager.h"
-#include "1_Entities/Word.h"   
+#include "1_Entities/GuessSession.h"
 #include <QString>
 #include <QChar>
 
@@ -19,7 +19,8 @@
  * @class GameStateManager
  * @brief Orchestrates the game flow and state transitions.
  * * This class acts as a controller that handles starting new games, 
- * processing player guesses, and persisting game states via repositories.
+ * processing player guesses, and recording finished and abandoned games
+ * in the history repository.
  */
 class GameStateManager {
 public:
@@ -30,22 +31,30 @@ public:
 	     */
     GameStateManager(GameStateRepository* repository, WordManager* wordManager); 
 
+    /**
+     * @brief Sets the player whose games are recorded.
+     * @param playerName Name of the player. A game still running for the
+     *        previous player is recorded as abandoned first.
+     */
+    void setPlayer(const QString& playerName);
+
     /**
 	 * @brief Initiates a new game session with a random word from a category.
      * @param categoryName The name of the category (e.g., "Animals", "Plants").
 	     */
     void startNewGame(QString categoryName);
     
-    /** @brief Loads the most recently saved game state from the repository. */
-    void loadLastGame();
-    
     /**
      * @brief Handles the logic for a player's letter guess.
      * @param letter The character guessed by the player.
 	     */
     void makeGuess(QChar letter);
     
-    /** @brief Saves the current game session to the repository. */
+    /**
+     * @brief Records the current game session in the history.
+     * * A game that is not over yet is recorded as abandoned. Each session
+     * is recorded once; later calls do nothing until the next game starts.
+     */
     void saveCurrentGame();
     
    /**
@@ -60,7 +69,9 @@ public:
 private:
     GameStateRepository* m_repository; ///< Repository for state persistence.
     WordManager* m_wordManager;      ///< Manager for word-related logic.
-    GameState* m_currentGameState = nullptr;  ///< Pointer to the current active session.
+    GameState* m_currentGameState = nullptr;  ///< Current session; owned by the manager.
+    bool m_currentGameSaved = false;  ///< Whether the current session is already in the history.
+    QString m_playerName;  ///< Player whose games are recorded.
     
     /** @brief Prevent copying to ensure single management of game resources. */
     GameStateManager(const GameStateManager&) = delete;
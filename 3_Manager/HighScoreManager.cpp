@@ -1,5 +1,4 @@
 #include "3_Manager/HighScoreManager.h"
-#include <algorithm>
 
 /**
  * @brief Constructs a HighScoreManager using an existing PlayerRepository.
@@ -13,22 +12,117 @@ HighScoreManager::HighScoreManager(PlayerRepository* repository)
  * @param topN Number of highest-scoring players to return.
  * @return QList of Player pointers sorted in descending order by score.
  *
- * The function copies the list of all players, sorts them using std::sort and trims the list to the desired size.
+ * Walks the ranking index from the top, so the cost is O(topN + log n).
  */
 QList<Player*> HighScoreManager::getHighScores(int topN) {
-    QList<Player*> players = repository->getAllPlayers();
+    return repository->getRanking().top(topN);
+}
 
-    // Sort players
-    std::sort(players.begin(), players.end(),
-              [](Player* a, Player* b) {
-                  return a->getScore() > b->getScore();
-              });
+/**
+ * @brief Returns the rank of a player.
+ * @param player The player to look up.
+ * @return 1 for the best player, or 0 if the player is unknown.
+ */
+int HighScoreManager::getRank(const Player* player) const {
+    return repository->getRanking().rankOf(player);
+}
 
-    // Trims the list
-    if (players.size() > topN)
-        players = players.mid(0, topN);
+/**
+ * @brief Returns the players ranked around a player.
+ * @param player The player in the middle.
+ * @param radius Number of neighbours on each side.
+ * @return Players in rank order, including the given player.
+ */
+QList<Player*> HighScoreManager::getPlayersAround(const Player* player, int radius) const {
+    return repository->getRanking().around(player, radius);
+}
+
+/**
+ * @brief Rolls the boards forward to today and returns an overall window.
+ * @param period The period.
+ * @return The window, or nullptr for AllTime (served by the lifetime ranking).
+ */
+const ScoreWindow* HighScoreManager::getWindow(LeaderboardPeriod period) {
+    ScoreLeaderboards& leaderboards = repository->getLeaderboards();
+    leaderboards.advanceTo(ScoreLeaderboards::today());
+    return leaderboards.window(period);
+}
 
-    return players;
+/**
+ * @brief Rolls the boards forward to today and returns a category window.
+ * @param period The period.
+ * @param category The category.
+ * @return The window.
+ */
+const ScoreWindow* HighScoreManager::getWindow(LeaderboardPeriod period, CategoryEnum category) {
+    ScoreLeaderboards& leaderboards = repository->getLeaderboards();
+    leaderboards.advanceTo(ScoreLeaderboards::today());
+    return leaderboards.window(period, category);
 }
 
+/**
+ * @brief Retrieves the best players of a period across every category.
+ * @param topN Number of top players to return.
+ * @param period Daily, Weekly or AllTime (lifetime score).
+ * @return Players in rank order.
+ */
+QList<Player*> HighScoreManager::getHighScores(int topN, LeaderboardPeriod period) {
+    const ScoreWindow* window = getWindow(period);
+    return window ? window->getRanking().top(topN) : getHighScores(topN);
+}
 
+/**
+ * @brief Retrieves the best players of a period in one category.
+ * @param topN Number of top players to return.
+ * @param period The period.
+ * @param category The category.
+ * @return Players in rank order.
+ */
+QList<Player*> HighScoreManager::getHighScores(int topN, LeaderboardPeriod period, CategoryEnum category) {
+    return getWindow(period, category)->getRanking().top(topN);
+}
+
+/**
+ * @brief Returns the rank of a player in a period across every category.
+ * @param player The player to look up.
+ * @param period The period.
+ * @return 1 for the best player, or 0 if the player is not on the board.
+ */
+int HighScoreManager::getRank(const Player* player, LeaderboardPeriod period) {
+    const ScoreWindow* window = getWindow(period);
+    return window ? window->getRanking().rankOf(player) : getRank(player);
+}
+
+/**
+ * @brief Returns the rank of a player in a period and category.
+ * @param player The player to look up.
+ * @param period The period.
+ * @param category The category.
+ * @return 1 for the best player, or 0 if the player is not on the board.
+ */
+int HighScoreManager::getRank(const Player* player, LeaderboardPeriod period, CategoryEnum category) {
+    return getWindow(period, category)->getRanking().rankOf(player);
+}
+
+/**
+ * @brief Returns the points of a player in a period across every category.
+ * @param player The player to look up.
+ * @param period The period; AllTime is the lifetime score.
+ * @return The points.
+ */
+int HighScoreManager::getScore(const Player* player, LeaderboardPeriod period) {
+    const ScoreWindow* window = getWindow(period);
+    if (!window) return player ? player->getScore() : 0;
+    return window->scoreOf(player);
+}
+
+/**
+ * @brief Returns the points of a player in a period and category.
+ * @param player The player to look up.
+ * @param period The period.
+ * @param category The category.
+ * @return The points.
+ */
+int HighScoreManager::getScore(const Player* player, LeaderboardPeriod period, CategoryEnum category) {
+    return getWindow(period, category)->scoreOf(player);
+}
@@ -2,10 +2,16 @@
 #define HIGHSCOREMANAGER_H
 
 #include "2_Repository/PlayerRepository.h"
+#include "0_Enums/LeaderboardPeriod.h"
 
 /**
  * @class HighScoreManager
  * @brief Provides functionality for retrieving top-scoring players.
+ *
+ * Queries are answered from the repository's PlayerRanking, so no call
+ * copies or sorts the full player list. Daily, weekly and per-category
+ * boards come from the repository's ScoreLeaderboards; their windows are
+ * rolled forward to today before every query.
  */
 class HighScoreManager {
 private:
@@ -25,6 +31,87 @@ public:
      * @return QList of Player pointers sorted by descending score.
      */
     QList<Player*> getHighScores(int topN);
+
+    /**
+     * @brief Returns the rank of a player.
+     * @param player The player to look up.
+     * @return 1 for the best player, or 0 if the player is unknown.
+     */
+    int getRank(const Player* player) const;
+
+    /**
+     * @brief Returns the players ranked around a player.
+     * @param player The player in the middle.
+     * @param radius Number of neighbours on each side.
+     * @return Players in rank order, including the given player.
+     */
+    QList<Player*> getPlayersAround(const Player* player, int radius) const;
+
+    /**
+     * @brief Retrieves the best players of a period across every category.
+     * @param topN Number of top players to return.
+     * @param period Daily, Weekly or AllTime (lifetime score).
+     * @return Players in rank order; only players active in the period are listed.
+     */
+    QList<Player*> getHighScores(int topN, LeaderboardPeriod period);
+
+    /**
+     * @brief Retrieves the best players of a period in one category.
+     * @param topN Number of top players to return.
+     * @param period The period.
+     * @param category The category.
+     * @return Players in rank order; only players who scored in the category are listed.
+     */
+    QList<Player*> getHighScores(int topN, LeaderboardPeriod period, CategoryEnum category);
+
+    /**
+     * @brief Returns the rank of a player in a period across every category.
+     * @param player The player to look up.
+     * @param period The period.
+     * @return 1 for the best player, or 0 if the player is not on the board.
+     */
+    int getRank(const Player* player, LeaderboardPeriod period);
+
+    /**
+     * @brief Returns the rank of a player in a period and category.
+     * @param player The player to look up.
+     * @param period The period.
+     * @param category The category.
+     * @return 1 for the best player, or 0 if the player is not on the board.
+     */
+    int getRank(const Player* player, LeaderboardPeriod period, CategoryEnum category);
+
+    /**
+     * @brief Returns the points of a player in a period across every category.
+     * @param player The player to look up.
+     * @param period The period; AllTime is the lifetime score.
+     * @return The points.
+     */
+    int getScore(const Player* player, LeaderboardPeriod period);
+
+    /**
+     * @brief Returns the points of a player in a period and category.
+     * @param player The player to look up.
+     * @param period The period.
+     * @param category The category.
+     * @return The points.
+     */
+    int getScore(const Player* player, LeaderboardPeriod period, CategoryEnum category);
+
+    /**
+     * @brief Rolls the boards forward to today and returns the board of a period.
+     * @param period The period.
+     * @return The window, or nullptr for AllTime (served by the lifetime ranking).
+     */
+    const ScoreWindow* getWindow(LeaderboardPeriod period);
+
+    /**
+     * @brief Rolls the boards forward to today and returns the board of a period in one category.
+     * @param period The period.
+     * @param category The category.
+     * @return The window.
+     */
+    const ScoreWindow* getWindow(LeaderboardPeriod period, CategoryEnum category);
 };
 
 #endif // HIGHSCOREMANAGER_H
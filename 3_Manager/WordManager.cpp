@@ -2,8 +2,6 @@
 #include "2_Repository/IWordRepository.h"
 #include <algorithm>
 #include <random>
-#include <ctime>
-#include <unordered_set>
 #include <iostream>
 using namespace std;
 
@@ -11,75 +9,168 @@ using namespace std;
  * @brief Constructs a WordManager with a given word repository.
  * 
  * @param repository Pointer to an IWordRepository implementation.
+ * @param seed Seed for word selection.
  */
-WordManager::WordManager(IWordRepository* repository)
-    : repository(repository), currentWord(nullptr), score(0) {}
+WordManager::WordManager(IWordRepository* repository, uint64_t seed)
+    : repository(repository), currentSession(nullptr), score(0), currentPosition(0), random(seed) {}
 
-/** 
- * @brief Set of words already used in the game.
- * @details Keeps track of words to avoid repetition.
+/**
+ * @brief Selects the player whose used words are tracked.
+ * 
+ * Each player keeps their own pools, so switching players does not
+ * affect which words the others have left.
+ * 
+ * @param playerName Name of the player.
+ */
+void WordManager::setPlayer(const string& playerName) {
+    currentPlayer = playerName;
+}
+
+/**
+ * @brief Returns the current player's pool for a category.
+ * 
+ * @param category The category of the pool.
+ * @return Reference to the pool, covering every word in the category.
+ */
+WordSampler& WordManager::getSampler(CategoryEnum category) {
+    WordSampler& sampler = samplers[currentPlayer][static_cast<int>(category)];
+    sampler.grow(static_cast<uint32_t>(repository->getWordIdsByCategory(category).size()));
+    return sampler;
+}
+
+/**
+ * @brief Finds the position of an entry in its category's ID list.
+ * 
+ * Category ID lists are in ascending order, so a binary search is enough.
+ * 
+ * @param entry The entry to look up.
+ * @param position Receives the position if found.
+ * @return true if the entry is in the list, false otherwise.
  */
-unordered_set<string> usedWords;
+bool WordManager::findPosition(const DictionaryEntry& entry, uint32_t& position) {
+    const vector<uint32_t>& ids = repository->getWordIdsByCategory(entry.getCategory());
+    auto found = lower_bound(ids.begin(), ids.end(), entry.getId());
+    if (found == ids.end() || *found != entry.getId()) return false;
+
+    position = static_cast<uint32_t>(found - ids.begin());
+    return true;
+}
+
+/**
+ * @brief Makes every word of a category available again for the current player.
+ * 
+ * @param category The category to reset.
+ */
+void WordManager::resetCategory(CategoryEnum category) {
+    getSampler(category).reset();
+}
 
 /**
  * @brief Marks a word as used in the game.
  * 
- * @param word Pointer to the Word to mark as used.
+ * @param session Pointer to the GuessSession whose word is marked as used.
  */
-void WordManager::markWordAsUsed(Word* word) {
-    if(word != nullptr) {
-        usedWords.insert(word->getWord());
-    }
+void WordManager::markWordAsUsed(GuessSession* session) {
+    if (session == nullptr) return;
+
+    uint32_t position = currentPosition;
+    if (session != currentSession && !findPosition(session->getEntry(), position)) return;
+
+    getSampler(session->getCategory()).markUsed(position);
 }
 
 /**
- * @brief Checks if a word has already been used.
+ * @brief Checks if a word has already been used by the current player.
  * 
- * @param word The word to check.
+ * @param entry The dictionary entry to check.
  * @return true if the word was used before, false otherwise.
  */
-bool WordManager::isWordUsed(const std::string& word) {
-    return usedWords.count(word) > 0;
+bool WordManager::isWordUsed(const DictionaryEntry& entry) {
+    uint32_t position;
+    if (!findPosition(entry, position)) return false;
+
+    return getSampler(entry.getCategory()).isUsed(position);
+}
+
+/**
+ * @brief Maps a category name to its CategoryEnum value.
+ * 
+ * @param categoryName Name of the category (e.g. "Animals").
+ * @return The matching category, or CategoryEnum::Unspecified if unknown.
+ */
+CategoryEnum WordManager::categoryFromName(const string& categoryName) {
+    if (categoryName == "Animals") return CategoryEnum::Animals;
+    if (categoryName == "Plants") return CategoryEnum::Plants;
+    if (categoryName == "Technology") return CategoryEnum::Technology;
+    if (categoryName == "Cities") return CategoryEnum::Cities;
+    if (categoryName == "Jobs") return CategoryEnum::Jobs;
+    if (categoryName == "Movies") return CategoryEnum::Movies;
+    return CategoryEnum::Unspecified;
 }
 
 /**
  * @brief Starts a new game by selecting a word from the given category.
  * 
  * @param categoryName Name of the category.
- * @details Filters out words already used. Randomly selects a word from the remaining ones.
+ * @details Unknown category names do not start a game.
  */
 void WordManager::startNewGame(string categoryName) {
-    vector<Word> filteredWords;
-
-    for (Word w : repository->getAllWords()) {
-        if (
-            ((categoryName == "Animals" && w.getCategory() == CategoryEnum::Animals) ||
-             (categoryName == "Plants" && w.getCategory() == CategoryEnum::Plants) ||
-             (categoryName == "Technology" && w.getCategory() == CategoryEnum::Technology) ||
-             (categoryName == "Cities" && w.getCategory() == CategoryEnum::Cities) ||
-             (categoryName == "Jobs" && w.getCategory() == CategoryEnum::Jobs) ||
-             (categoryName == "Movies" && w.getCategory() == CategoryEnum::Movies))
-            && !isWordUsed(w.getWord())
-           )
-        {
-            filteredWords.push_back(w);
-        }
+    CategoryEnum category = categoryFromName(categoryName);
+    if (category == CategoryEnum::Unspecified) {
+        endSession();
+        return;
     }
 
-    if (filteredWords.empty()) return;
+    startNewGame(category);
+}
+
+/**
+ * @brief Starts a new game by selecting a word from the given category.
+ * 
+ * @param category The category to pick from.
+ * @details Draws from the current player's pool of unused words in the
+ * category, so the cost does not depend on the dictionary or category size.
+ * The previous session ends first, so a failed draw leaves no session behind.
+ */
+void WordManager::startNewGame(CategoryEnum category) {
+    endSession();
+
+    WordSampler& sampler = getSampler(category);
+    if (sampler.remaining() == 0) return;
+
+    uint32_t position = sampler.pick(random);
+    uint32_t id = repository->getWordIdsByCategory(category)[position];
+    const DictionaryEntry* entry = repository->getWordById(id);
+    if (entry == nullptr) return;
+
+    currentPosition = position;
+    currentSession = new GuessSession(*entry);
+}
 
-    srand(time(nullptr));
-    int index = rand() % filteredWords.size();
-    currentWord = new Word(filteredWords[index]);
+/**
+ * @brief Ends the current guess session, if any.
+ */
+void WordManager::endSession() {
+    delete currentSession;
+    currentSession = nullptr;
 }
 
 /**
- * @brief Returns the current Word object.
+ * @brief Returns the current guess session.
  * 
- * @return Pointer to the current Word, or nullptr if no game started.
+ * @return Pointer to the current GuessSession, or nullptr if no game started.
  */
-Word* WordManager::getCurrentWord() {
-    return currentWord;
+GuessSession* WordManager::getCurrentSession() {
+    return currentSession;
+}
+
+/**
+ * @brief Returns the position of the current word in its category's ID list.
+ * 
+ * @return The position; meaningless if no game started.
+ */
+uint32_t WordManager::getCurrentPosition() const {
+    return currentPosition;
 }
 
 /**
@@ -90,9 +181,9 @@ Word* WordManager::getCurrentWord() {
  * @details Updates score: +5 for correct, -2 for incorrect guesses.
  */
 bool WordManager::makeGuess(char letter) {
-    if (currentWord == nullptr) return false;
+    if (currentSession == nullptr) return false;
 
-    bool correct = currentWord->guessLetter(letter);
+    bool correct = currentSession->guessLetter(letter);
     if (correct) {
         updateScore(5);
     } else {
@@ -105,19 +196,24 @@ bool WordManager::makeGuess(char letter) {
  * @brief Returns the masked version of the current word.
  * 
  * @return String with unguessed letters replaced by underscores.
+ * @details The string is maintained incrementally by the GuessSession, so no
+ * rebuild happens here.
  */
-string WordManager::getMaskedWord() {
-    if (currentWord == nullptr) return "";
+const string& WordManager::getMaskedWord() {
+    static const string empty;
+    if (currentSession == nullptr) return empty;
+    return currentSession->getMaskedWord();
+}
 
-    string masked = "";
-    for (char c : currentWord->getWord()) {
-        if (currentWord->isLetterGuessed(c)) {
-            masked += c;
-        } else {
-            masked += '_';
-        }
-    }
-    return masked;
+/**
+ * @brief Returns the masked current word with spaces between letters.
+ * 
+ * @return Display-ready masked word (e.g. "_ a _").
+ */
+const QString& WordManager::getMaskedDisplayText() {
+    static const QString empty;
+    if (currentSession == nullptr) return empty;
+    return currentSession->getDisplayText();
 }
 
 /**
@@ -126,8 +222,8 @@ string WordManager::getMaskedWord() {
  * @return true if all letters have been guessed, false otherwise.
  */
 bool WordManager::isGameWon() {
-    if (currentWord == nullptr) return false;
-    return currentWord->isGuessed();
+    if (currentSession == nullptr) return false;
+    return currentSession->isGuessed();
 }
 
 /**
@@ -136,8 +232,8 @@ bool WordManager::isGameWon() {
  * Marks the current word as used to prevent repetition.
  */
 void WordManager::onGameWon() {
-    if (currentWord != nullptr) {
-        markWordAsUsed(currentWord);
+    if (currentSession != nullptr) {
+        markWordAsUsed(currentSession);
     }
 }
 
@@ -1,7 +1,11 @@
 #pragma once
 #include <string>
-#include <unordered_set>
-#include "1_Entities/Word.h"
+#include <string_view>
+#include <array>
+#include <unordered_map>
+#include "1_Entities/GuessSession.h"
+#include "1_Entities/WordSampler.h"
+#include "1_Entities/RandomGenerator.h"
 #include "2_Repository/IWordRepository.h"
 #include "0_Enums/CategoryEnum.h"
 
@@ -13,36 +17,108 @@ using namespace std;
  * 
  * This class handles interactions between the game and the word repository,
  * including selecting words, tracking score, checking guesses, and managing used words.
+ * 
+ * Used words are tracked per player and per category by WordSampler
+ * pools, so drawing a fresh word and marking it used are constant time.
  */
 class WordManager {
 private:
     /** Pointer to the word repository */
     IWordRepository* repository;
 
-    /** Pointer to the current word in the game */
-    Word* currentWord;
+    /** Guess session for the current word in the game */
+    GuessSession* currentSession;
 
     /** Current game score */
     int score;
 
-    /** Set of words already used in the game */
-    unordered_set<std::string> usedWords;
+    /** Name of the player whose used words are tracked */
+    string currentPlayer;
+
+    /** Unused-word pools of each player, one per category */
+    unordered_map<string, array<WordSampler, CategoryCount>> samplers;
+
+    /** Position of the current word in its category's ID list */
+    uint32_t currentPosition;
+
+    /** Generator used to pick words; owned by this manager only */
+    RandomGenerator random;
+
+    /**
+     * @brief Returns the current player's pool for a category.
+     * 
+     * The pool is extended first if words were added to the category.
+     * 
+     * @param category The category of the pool.
+     * @return Reference to the pool.
+     */
+    WordSampler& getSampler(CategoryEnum category);
+
+    /**
+     * @brief Finds the position of an entry in its category's ID list.
+     * 
+     * @param entry The entry to look up.
+     * @param position Receives the position if found.
+     * @return true if the entry is in the list, false otherwise.
+     */
+    bool findPosition(const DictionaryEntry& entry, uint32_t& position);
+
+    /**
+     * @brief Maps a category name to its CategoryEnum value.
+     * 
+     * @param categoryName Name of the category (e.g. "Animals").
+     * @return The matching category, or CategoryEnum::Unspecified if unknown.
+     */
+    static CategoryEnum categoryFromName(const string& categoryName);
+
+    /**
+     * @brief Ends the current guess session, if any.
+     * 
+     * The session is deleted; the manager owns every session it started.
+     */
+    void endSession();
 
 public:
     /**
      * @brief Constructs the WordManager with a repository.
      * 
      * @param repository Pointer to an IWordRepository implementation.
+     * @param seed Seed for word selection; fixed seeds make games reproducible.
      */
-    WordManager(IWordRepository* repository);
+    WordManager(IWordRepository* repository, uint64_t seed = RandomGenerator::randomSeed());
+
+    /**
+     * @brief Selects the player whose used words are tracked.
+     * 
+     * @param playerName Name of the player.
+     */
+    void setPlayer(const string& playerName);
+
+    /**
+     * @brief Makes every word of a category available again for the current player.
+     * 
+     * @param category The category to reset.
+     */
+    void resetCategory(CategoryEnum category);
 
     /**
      * @brief Starts a new game with a given category.
      * 
      * @param categoryName Name of the category to select a word from.
+     * @details The previous session always ends; if no word can be drawn,
+     * getCurrentSession() returns nullptr afterwards.
      */
     void startNewGame(string categoryName);
 
+    /**
+     * @brief Starts a new game with a word from the given category.
+     * 
+     * @param category Category to select a word from.
+     * @details The previous session always ends; if no word can be drawn,
+     * getCurrentSession() returns nullptr afterwards.
+     */
+    void startNewGame(CategoryEnum category);
+
     /**
      * @brief Makes a letter guess for the current word.
      * 
@@ -57,7 +133,14 @@ public:
      * 
      * @return A string with unguessed letters masked.
      */
-    string getMaskedWord();
+    const string& getMaskedWord();
+
+    /**
+     * @brief Returns the masked word spaced out for display.
+     * 
+     * @return A string with unguessed letters masked and a space between letters.
+     */
+    const QString& getMaskedDisplayText();
 
     /**
      * @brief Checks if the current game is won.
@@ -81,26 +164,33 @@ public:
     int getScore();
 
     /**
-     * @brief Returns the current Word object.
+     * @brief Returns the current guess session.
+     * 
+     * @return Pointer to the current GuessSession.
+     */
+    GuessSession* getCurrentSession();
+
+    /**
+     * @brief Returns the position of the current word in its category's ID list.
      * 
-     * @return Pointer to the current Word.
+     * @return The position; meaningless if no game started.
      */
-    Word* getCurrentWord();
+    uint32_t getCurrentPosition() const;
 
     /**
      * @brief Marks a word as used in the game.
      * 
-     * @param word Pointer to the Word to mark as used.
+     * @param session Pointer to the GuessSession whose word is marked as used.
      */
-    void markWordAsUsed(Word* word);
+    void markWordAsUsed(GuessSession* session);
 
     /**
-     * @brief Checks if a word has already been used in the game.
+     * @brief Checks if a word has already been used by the current player.
      * 
-     * @param word The word to check.
+     * @param entry The dictionary entry to check.
      * @return true if the word was used before, false otherwise.
      */
-    bool isWordUsed(const std::string& word);
+    bool isWordUsed(const DictionaryEntry& entry);
 
     /**
      * @brief Handles logic when the game is won.
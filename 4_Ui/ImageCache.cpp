@@ -0,0 +1,126 @@
+/**
+ * @file ImageCache.cpp
+ * @brief Implementation of the ImageCache service.
+ * * Handles scaled decoding of image resources and the bounded pixmap cache.
+ */
+
+#include "4_Ui/ImageCache.h"
+#include <QFileInfo>
+#include <QImage>
+#include <QImageReader>
+#include <QDebug>
+
+/**
+ * @brief Constructs an image cache.
+ * @param maxBytes Upper bound for the pixel memory of cached pixmaps.
+ */
+ImageCache::ImageCache(int maxBytes)
+    : cache(maxBytes), hitCount(0), missCount(0)
+{
+}
+
+/**
+ * @brief Returns an image decoded to fit a logical size.
+ * @param path Resource or file path of the image.
+ * @param size Logical size the image is drawn at; the aspect ratio is kept.
+ * @param devicePixelRatio Ratio of device pixels to logical pixels.
+ * @return The pixmap, tagged with the device pixel ratio, or a null pixmap on error.
+ */
+QPixmap ImageCache::pixmap(const QString& path, const QSize& size, qreal devicePixelRatio)
+{
+    const QString key = QString("%1|%2x%3|%4")
+                            .arg(path).arg(size.width()).arg(size.height()).arg(devicePixelRatio);
+
+    if (QPixmap* cached = cache.object(key)) {
+        hitCount++;
+        return *cached;
+    }
+
+    missCount++;
+    QPixmap pix = decode(path, size, devicePixelRatio);
+    if (pix.isNull()) return pix;
+
+    // Cost is the pixel memory, so the limit is a real memory bound
+    const int cost = pix.width() * pix.height() * pix.depth() / 8;
+    cache.insert(key, new QPixmap(pix), cost);
+    return pix;
+}
+
+/**
+ * @brief Returns an icon holding the image at one logical size.
+ * @param path Resource or file path of the image.
+ * @param size Logical size the icon is drawn at.
+ * @param devicePixelRatio Ratio of device pixels to logical pixels.
+ * @return The icon, or a null icon on error.
+ */
+QIcon ImageCache::icon(const QString& path, const QSize& size, qreal devicePixelRatio)
+{
+    QPixmap pix = pixmap(path, size, devicePixelRatio);
+    return pix.isNull() ? QIcon() : QIcon(pix);
+}
+
+/**
+ * @brief Returns how many requests were served from the cache.
+ */
+int ImageCache::hits() const
+{
+    return hitCount;
+}
+
+/**
+ * @brief Returns how many requests had to decode an image.
+ */
+int ImageCache::misses() const
+{
+    return missCount;
+}
+
+/**
+ * @brief Drops every cached pixmap; counters are kept.
+ */
+void ImageCache::clear()
+{
+    cache.clear();
+}
+
+/**
+ * @brief Decodes an image at a device-pixel size.
+ * @param path Resource or file path of the image.
+ * @param size Logical bounding size.
+ * @param devicePixelRatio Ratio of device pixels to logical pixels.
+ * @return The decoded pixmap, or a null pixmap on error.
+ * * Only the pixels that will be shown are produced: formats that support
+ * scaled decoding never materialise the full image.
+ */
+QPixmap ImageCache::decode(const QString& path, const QSize& size, qreal devicePixelRatio)
+{
+    // Prefer the baked @2x variant on high-DPI screens
+    QString source = path;
+    if (devicePixelRatio > 1.0) {
+        QFileInfo info(path);
+        QString hiDpi = info.path() + "/" + info.completeBaseName() + "@2x." + info.suffix();
+        if (QFileInfo::exists(hiDpi)) source = hiDpi;
+    }
+
+    QImageReader reader(source);
+    const QSize original = reader.size();
+    const QSize target = size * devicePixelRatio;
+    if (original.isValid() && !target.isEmpty()) {
+        // Keep the aspect ratio inside the requested box and never upscale
+        QSize scaled = original.scaled(target, Qt::KeepAspectRatio);
+        if (scaled.width() < original.width()) {
+            reader.setScaledSize(scaled);
+        }
+    }
+    reader.setQuality(100);
+
+    QImage image = reader.read();
+    if (image.isNull()) {
+        qDebug() << "Failed to decode image:" << source << reader.errorString();
+        return QPixmap();
+    }
+
+    QPixmap pix = QPixmap::fromImage(image);
+    pix.setDevicePixelRatio(devicePixelRatio);
+    return pix;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file ImageCache.h
+ * @brief Header file for the ImageCache service.
+ * * Declares a shared loader that decodes image resources directly at the
+ * size they are displayed at and keeps the results in a bounded cache.
+ */
+
+#ifndef IMAGECACHE_H
+#define IMAGECACHE_H
+
+#include <QCache>
+#include <QIcon>
+#include <QPixmap>
+#include <QSize>
+#include <QString>
+
+/**
+ * @class ImageCache
+ * @brief Decodes images at their display size and caches the pixmaps.
+ * * Images are read with QImageReader::setScaledSize(), so a 1500x1500
+ * avatar shown at 65 px is never decoded at full size. On high-DPI
+ * screens a baked "@2x" variant is preferred when one exists.
+ * * Results are cached by (path, logical size, device pixel ratio) in a
+ * QCache bounded by pixel memory; hit and miss counters show how well
+ * the cache works.
+ */
+class ImageCache
+{
+public:
+    /**
+     * @brief Constructs an image cache.
+     * @param maxBytes Upper bound for the pixel memory of cached pixmaps.
+     */
+    explicit ImageCache(int maxBytes = 32 * 1024 * 1024);
+
+    /**
+     * @brief Returns an image decoded to fit a logical size.
+     * @param path Resource or file path of the image.
+     * @param size Logical size the image is drawn at; the aspect ratio is kept.
+     * @param devicePixelRatio Ratio of device pixels to logical pixels.
+     * @return The pixmap, tagged with the device pixel ratio, or a null pixmap on error.
+     */
+    QPixmap pixmap(const QString& path, const QSize& size, qreal devicePixelRatio = 1.0);
+
+    /**
+     * @brief Returns an icon holding the image at one logical size.
+     * @param path Resource or file path of the image.
+     * @param size Logical size the icon is drawn at.
+     * @param devicePixelRatio Ratio of device pixels to logical pixels.
+     * @return The icon, or a null icon on error.
+     */
+    QIcon icon(const QString& path, const QSize& size, qreal devicePixelRatio = 1.0);
+
+    /** @brief Returns how many requests were served from the cache. */
+    int hits() const;
+
+    /** @brief Returns how many requests had to decode an image. */
+    int misses() const;
+
+    /** @brief Drops every cached pixmap; counters are kept. */
+    void clear();
+
+private:
+    /**
+     * @brief Decodes an image at a device-pixel size.
+     * @param path Resource or file path of the image.
+     * @param size Logical bounding size.
+     * @param devicePixelRatio Ratio of device pixels to logical pixels.
+     * @return The decoded pixmap, or a null pixmap on error.
+     */
+    static QPixmap decode(const QString& path, const QSize& size, qreal devicePixelRatio);
+
+    /** @brief Cached pixmaps keyed by path, size and device pixel ratio; cost is in bytes. */
+    QCache<QString, QPixmap> cache;
+
+    /** @brief Requests served from the cache. */
+    int hitCount;
+
+    /** @brief Requests that required a decode. */
+    int missCount;
+};
+
+#endif // IMAGECACHE_H
@@ -0,0 +1,67 @@
+/**
+ * @file LeaderboardDelegate.cpp
+ * @brief Implementation of the LeaderboardDelegate class.
+ */
+
+#include "4_Ui/LeaderboardDelegate.h"
+#include "4_Ui/LeaderboardModel.h"
+#include <QPainter>
+#include <QFont>
+#include <QFontMetrics>
+#include <QColor>
+
+/**
+ * @brief Constructs the delegate.
+ * @param imageCache Cache used for the avatar pictures.
+ * @param parent Owning QObject.
+ */
+LeaderboardDelegate::LeaderboardDelegate(ImageCache *imageCache, QObject *parent)
+    : QStyledItemDelegate(parent), imageCache(imageCache)
+{
+}
+
+/**
+ * @brief Paints one cell.
+ * @param painter Painter of the view.
+ * @param option Style options of the cell.
+ * @param index The cell being painted.
+ * * Avatar cells get the picture centred near the top with the level name
+ * below it, matching the layout of the former cell widget.
+ */
+void LeaderboardDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    if (index.column() != LeaderboardModel::AvatarColumn) {
+        QStyledItemDelegate::paint(painter, option, index);
+        return;
+    }
+
+    const int avatarId = index.data(LeaderboardModel::AvatarIdRole).toInt();
+    const QString level = index.data(LeaderboardModel::LevelRole).toString();
+    const QRect cell = option.rect.adjusted(0, 5, 0, -5);
+
+    QPixmap avatar = imageCache->pixmap(QString(":/6_Images/Avatars/avatar%1.png").arg(avatarId + 1),
+                                        QSize(AvatarSize, AvatarSize),
+                                        painter->device()->devicePixelRatioF());
+
+    QFont levelFont = option.font;
+    levelFont.setPointSize(11);
+    levelFont.setBold(true);
+    const int levelHeight = QFontMetrics(levelFont).height();
+
+    // Centre the avatar and the level line as one block
+    const int blockHeight = AvatarSize + 6 + levelHeight;
+    const int top = cell.top() + (cell.height() - blockHeight) / 2;
+
+    painter->save();
+    if (!avatar.isNull()) {
+        const QSize logical = avatar.size() / avatar.devicePixelRatio();
+        painter->drawPixmap(cell.left() + (cell.width() - logical.width()) / 2,
+                            top + (AvatarSize - logical.height()) / 2, avatar);
+    }
+
+    painter->setFont(levelFont);
+    painter->setPen(QColor("#7f8c8d"));
+    painter->drawText(QRect(cell.left(), top + AvatarSize + 6, cell.width(), levelHeight),
+                      Qt::AlignCenter, level);
+    painter->restore();
+}
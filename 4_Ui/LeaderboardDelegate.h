@@ -0,0 +1,47 @@
+/**
+ * @file LeaderboardDelegate.h
+ * @brief Header file for the LeaderboardDelegate class.
+ * * Declares the item delegate that paints leaderboard avatar cells.
+ */
+
+#ifndef LEADERBOARDDELEGATE_H
+#define LEADERBOARDDELEGATE_H
+
+#include <QStyledItemDelegate>
+#include "4_Ui/ImageCache.h"
+
+/**
+ * @class LeaderboardDelegate
+ * @brief Paints the avatar and level of a leaderboard row directly.
+ * * Replaces the per-row container widget, layout and labels: the avatar
+ * comes from the shared ImageCache at its display size and the level is
+ * drawn underneath it. Other columns use the default delegate.
+ */
+class LeaderboardDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+public:
+    /**
+     * @brief Constructs the delegate.
+     * @param imageCache Cache used for the avatar pictures.
+     * @param parent Owning QObject.
+     */
+    explicit LeaderboardDelegate(ImageCache *imageCache, QObject *parent = nullptr);
+
+    /**
+     * @brief Paints one cell.
+     * @param painter Painter of the view.
+     * @param option Style options of the cell.
+     * @param index The cell being painted.
+     */
+    void paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+
+private:
+    /** @brief Logical size of the avatar picture. */
+    static constexpr int AvatarSize = 65;
+
+    /** @brief Shared decoded-image cache (not owned). */
+    ImageCache *imageCache;
+};
+
+#endif // LEADERBOARDDELEGATE_H
@@ -0,0 +1,208 @@
+/**
+ * @file LeaderboardModel.cpp
+ * @brief Implementation of the LeaderboardModel class.
+ */
+
+#include "4_Ui/LeaderboardModel.h"
+#include <QBrush>
+#include <QColor>
+#include <QFont>
+
+/**
+ * @brief Constructs an empty leaderboard model.
+ * @param parent Owning QObject.
+ */
+LeaderboardModel::LeaderboardModel(QObject *parent)
+    : QAbstractTableModel(parent)
+{
+}
+
+/**
+ * @brief Selects the board shown.
+ * @param ranking Players in rank order.
+ * @param window Window of the ranking; nullptr for lifetime scores.
+ */
+void LeaderboardModel::setBoard(const PlayerRanking* ranking, const ScoreWindow* window)
+{
+    if (ranking == this->ranking && window == this->window) {
+        // A window rolled to a new day changes in place; repaint what is shown
+        syncRowCount();
+        if (rows > 0) emitRowsChanged(0, rows - 1);
+        return;
+    }
+
+    beginResetModel();
+    this->ranking = ranking;
+    this->window = window;
+    rows = ranking ? ranking->size() : 0;
+    endResetModel();
+}
+
+/**
+ * @brief Sets which player is highlighted.
+ * @param player The current player.
+ */
+void LeaderboardModel::setCurrentPlayer(const Player* player)
+{
+    if (player == currentPlayer) return;
+
+    const Player* previous = currentPlayer;
+    currentPlayer = player;
+    if (!ranking) return;
+    for (const Player* p : { previous, player }) {
+        const int row = p ? ranking->rankOf(p) - 1 : -1;
+        if (row >= 0 && row < rows) emitRowsChanged(row, row);
+    }
+}
+
+/**
+ * @brief Refreshes the rows a change of one player's score moved.
+ * @param player The player whose score changed.
+ * @param delta Change of the score.
+ * * The ranking does not say where the player was before, so every row
+ * between the new position and the end it came from is repainted; the
+ * view only redraws the rows it shows.
+ */
+void LeaderboardModel::refreshPlayer(const Player* player, int delta)
+{
+    if (!ranking) return;
+    syncRowCount();
+
+    const int row = ranking->rankOf(player) - 1;
+    if (row < 0 || row >= rows) return;
+    if (delta > 0) emitRowsChanged(row, rows - 1);
+    else if (delta < 0) emitRowsChanged(0, row);
+    else emitRowsChanged(row, row);
+}
+
+/**
+ * @brief Repaints the rows moved by a change of the lifetime score.
+ * @param player The player whose score changed.
+ * @param oldScore The score before the change.
+ */
+void LeaderboardModel::scoreChanged(Player* player, int oldScore)
+{
+    if (!window) refreshPlayer(player, player->getScore() - oldScore);
+}
+
+/**
+ * @brief Repaints the rows moved by points earned on the windowed boards.
+ * @param player The player who guessed.
+ * @param category Category of the word being guessed.
+ * @param points Points earned; negative for a penalty.
+ */
+void LeaderboardModel::pointsEarned(Player* player, CategoryEnum category, int points)
+{
+    Q_UNUSED(category);
+    if (window) refreshPlayer(player, points);
+}
+
+/**
+ * @brief Returns the player shown in a row.
+ * @param row Row index.
+ * @return The player, or nullptr if the row is out of range.
+ */
+const Player* LeaderboardModel::playerAt(int row) const
+{
+    return (ranking && row >= 0 && row < rows) ? ranking->playerAt(row + 1) : nullptr;
+}
+
+/**
+ * @brief Returns the number of ranked players.
+ */
+int LeaderboardModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : rows;
+}
+
+/**
+ * @brief Returns the number of leaderboard columns.
+ */
+int LeaderboardModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : ColumnCount;
+}
+
+/**
+ * @brief Returns the data of one cell.
+ * @param index Cell index.
+ * @param role Requested data role.
+ * @return The value for the role, or an invalid QVariant.
+ * * The current player's name and score are drawn in blue, the name bold.
+ */
+QVariant LeaderboardModel::data(const QModelIndex &index, int role) const
+{
+    const Player* p = playerAt(index.row());
+    if (!p) return QVariant();
+
+    const bool isCurrent = p == currentPlayer;
+
+    switch (role) {
+    case Qt::DisplayRole:
+        if (index.column() == NameColumn) return p->getName();
+        if (index.column() == ScoreColumn) return window ? window->scoreOf(p) : p->getScore();
+        return QVariant();
+    case Qt::TextAlignmentRole:
+        return int(Qt::AlignCenter);
+    case Qt::ForegroundRole:
+        if (isCurrent && index.column() != AvatarColumn) return QBrush(QColor("#3498db"));
+        return QVariant();
+    case Qt::FontRole:
+        if (isCurrent && index.column() == NameColumn) {
+            QFont font;
+            font.setBold(true);
+            return font;
+        }
+        return QVariant();
+    case AvatarIdRole:
+        return p->getAvatarId();
+    case LevelRole:
+        return p->getLevel();
+    default:
+        return QVariant();
+    }
+}
+
+/**
+ * @brief Returns the column titles.
+ */
+QVariant LeaderboardModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole) return QVariant();
+
+    switch (section) {
+    case AvatarColumn: return "Avatar";
+    case NameColumn:   return "Name";
+    case ScoreColumn:  return "Score";
+    default:           return QVariant();
+    }
+}
+
+/**
+ * @brief Emits dataChanged for every column of a range of rows.
+ * @param first First row.
+ * @param last Last row.
+ */
+void LeaderboardModel::emitRowsChanged(int first, int last)
+{
+    emit dataChanged(index(first, 0), index(last, ColumnCount - 1));
+}
+
+/**
+ * @brief Inserts or removes rows at the end until the view has one per ranked player.
+ * * Players entering or leaving the board shift the rows below them; the
+ * caller repaints those.
+ */
+void LeaderboardModel::syncRowCount()
+{
+    const int size = ranking ? ranking->size() : 0;
+    if (size > rows) {
+        beginInsertRows(QModelIndex(), rows, size - 1);
+        rows = size;
+        endInsertRows();
+    } else if (size < rows) {
+        beginRemoveRows(QModelIndex(), size, rows - 1);
+        rows = size;
+        endRemoveRows();
+    }
+}
@@ -0,0 +1,127 @@
+/**
+ * @file LeaderboardModel.h
+ * @brief Header file for the LeaderboardModel class.
+ * * Declares the table model that backs the Hall of Fame view.
+ */
+
+#ifndef LEADERBOARDMODEL_H
+#define LEADERBOARDMODEL_H
+
+#include <QAbstractTableModel>
+#include "1_Entities/Player.h"
+#include "2_Repository/PlayerRanking.h"
+#include "2_Repository/ScoreWindow.h"
+
+/**
+ * @class LeaderboardModel
+ * @brief Table model exposing ranked players to a QTableView.
+ * * The model reads straight from a PlayerRanking (and the ScoreWindow it
+ * belongs to, for windowed boards): row r is the player at rank r + 1 and
+ * nothing is copied per row. The view asks for the rows it actually shows,
+ * so opening the leaderboard costs the same for ten players or a hundred
+ * thousand.
+ * * Registered as an event listener of the PlayerRepository, it repaints
+ * the rows a score change moved and inserts or removes rows at the end
+ * when the board grows or shrinks; the board is only reset when another
+ * one is selected.
+ */
+class LeaderboardModel : public QAbstractTableModel, public PlayerObserver
+{
+    Q_OBJECT
+public:
+    /** @brief Columns shown by the leaderboard. */
+    enum Column {
+        AvatarColumn,   ///< Avatar picture and level
+        NameColumn,     ///< Player name
+        ScoreColumn,    ///< Total score
+        ColumnCount
+    };
+
+    /** @brief Extra data roles read by LeaderboardDelegate. */
+    enum Role {
+        AvatarIdRole = Qt::UserRole + 1,   ///< Avatar ID of the player (int)
+        LevelRole                          ///< Level name of the player (QString)
+    };
+
+    /**
+     * @brief Constructs an empty leaderboard model.
+     * @param parent Owning QObject.
+     */
+    explicit LeaderboardModel(QObject *parent = nullptr);
+
+    /**
+     * @brief Selects the board shown.
+     * @param ranking Players in rank order; not owned.
+     * @param window Window the ranking belongs to, whose scores are shown;
+     *        nullptr to show the lifetime score of each player.
+     * * Selecting the board already shown keeps the view and only brings its
+     * rows up to date.
+     */
+    void setBoard(const PlayerRanking* ranking, const ScoreWindow* window = nullptr);
+
+    /**
+     * @brief Sets which player is highlighted.
+     * @param player The current player.
+     * * Only the rows of the previous and new player are refreshed.
+     */
+    void setCurrentPlayer(const Player* player);
+
+    /**
+     * @brief Refreshes the rows a change of one player's score moved.
+     * @param player The player whose score changed.
+     * @param delta Change of the score; its sign tells which way the player moved.
+     */
+    void refreshPlayer(const Player* player, int delta);
+
+    /**
+     * @brief Repaints the rows moved by a change of the lifetime score.
+     * @param player The player whose score changed.
+     * @param oldScore The score before the change.
+     */
+    void scoreChanged(Player* player, int oldScore) override;
+
+    /**
+     * @brief Repaints the rows moved by points earned on the windowed boards.
+     * @param player The player who guessed.
+     * @param category Category of the word being guessed.
+     * @param points Points earned; negative for a penalty.
+     */
+    void pointsEarned(Player* player, CategoryEnum category, int points) override;
+
+    /**
+     * @brief Returns the player shown in a row.
+     * @param row Row index.
+     * @return The player, or nullptr if the row is out of range.
+     */
+    const Player* playerAt(int row) const;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+private:
+    /**
+     * @brief Emits dataChanged for every column of a range of rows.
+     * @param first First row.
+     * @param last Last row.
+     */
+    void emitRowsChanged(int first, int last);
+
+    /** @brief Inserts or removes rows at the end until the view has one per ranked player. */
+    void syncRowCount();
+
+    /** @brief Board shown; owned by the repository. */
+    const PlayerRanking* ranking = nullptr;
+
+    /** @brief Window of the board, or nullptr for lifetime scores. */
+    const ScoreWindow* window = nullptr;
+
+    /** @brief Row count last reported to the view. */
+    int rows = 0;
+
+    /** @brief The highlighted player. */
+    const Player* currentPlayer = nullptr;
+};
+
+#endif // LEADERBOARDMODEL_H
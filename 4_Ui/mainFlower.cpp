@@ -7,6 +7,7 @@
 
 #include "4_Ui/mainFlower.h"
 #include <QPainter>
+#include <QResizeEvent>
 #include <QDebug>
 
 /**
@@ -16,11 +17,16 @@
  * interfere with underlying UI elements. Sets the default leaf count to 6.
  */
 MainFlower::MainFlower(QWidget *parent)
-    : QWidget(parent), leafCount(6)
+    : QWidget(parent), scaledRatio(0), leafCount(6)
 {
     // Pass mouse clicks to the background/parent widgets
     setAttribute(Qt::WA_TransparentForMouseEvents);
 
+    // Re-scale the inactive stages once a burst of resize events is over
+    rescaleTimer.setSingleShot(true);
+    rescaleTimer.setInterval(150);
+    connect(&rescaleTimer, &QTimer::timeout, this, &MainFlower::rescaleStages);
+
     loadImages();
 
     // Start with 6 leaves (maximum health/attempts)
@@ -47,11 +53,51 @@ void MainFlower::loadImages()
     }
 }
 
+/**
+ * @brief Returns a stage scaled to the current widget size, scaling it if needed.
+ * @param stage The stage (leaf count) to fetch.
+ * @return The scaled pixmap, or a null pixmap if the stage is missing.
+ * * The cache is dropped whenever the widget size or device pixel ratio
+ * differs from the one it was built for.
+ */
+QPixmap MainFlower::scaledStage(int stage)
+{
+    const qreal ratio = devicePixelRatioF();
+    if(scaledSize != size() || scaledRatio != ratio) {
+        scaledStages.clear();
+        scaledSize = size();
+        scaledRatio = ratio;
+    }
+
+    auto cached = scaledStages.constFind(stage);
+    if(cached != scaledStages.constEnd()) return cached.value();
+
+    auto source = flowerStages.constFind(stage);
+    if(source == flowerStages.constEnd() || size().isEmpty()) return QPixmap();
+
+    // Fill the widget exactly, as the unscaled drawPixmap(rect()) did
+    QPixmap pix = source.value().scaled(size() * ratio, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+    pix.setDevicePixelRatio(ratio);
+    scaledStages.insert(stage, pix);
+    return pix;
+}
+
+/**
+ * @brief Scales every stage to the current widget size.
+ * * Runs after resizing settles so a later wrong guess never has to scale.
+ */
+void MainFlower::rescaleStages()
+{
+    for(auto it = flowerStages.constBegin(); it != flowerStages.constEnd(); ++it) {
+        scaledStage(it.key());
+    }
+}
+
 /**
  * @brief Updates the flower visual based on the provided count.
  * @param count The number of leaves (attempts) remaining (expected 0-6).
- * * This method ensures the count stays within bounds and loads the 
- * corresponding image asset. It then calls update() to trigger a repaint.
+ * * This method ensures the count stays within bounds and selects the
+ * corresponding pre-scaled stage. It then calls update() to trigger a repaint.
  */
 void MainFlower::setLeafCount(int count)
 {
@@ -61,28 +107,40 @@ void MainFlower::setLeafCount(int count)
 
     this->leafCount = count;
 
-    // Load the specific file for the current count to ensure accuracy
-    QString path = QString(":/6_Images/Backgrounds/flower%1.png").arg(count);
-    QPixmap newPix(path);
-
-    if(!newPix.isNull()) {
-        activeVisual = newPix;
-        update(); // Trigger the paintEvent
-    } else {
-        qDebug() << "Failed to load image file:" << path;
+    if(!flowerStages.contains(count)) {
+        qDebug() << "Failed to load image for stage:" << count;
+        return;
     }
+
+    // Sized on the first paint if the widget has no size yet
+    activeVisual = scaledStage(count);
+    update(); // Trigger the paintEvent
+}
+
+/**
+ * @brief Invalidates the scaled stages when the widget is resized.
+ * @param event The resize event.
+ */
+void MainFlower::resizeEvent(QResizeEvent *event)
+{
+    QWidget::resizeEvent(event);
+    activeVisual = QPixmap();
+    rescaleTimer.start();
 }
 
 /**
  * @brief Draws the active flower image onto the widget.
  * @param event The paint event (unused).
- * * Scales the image to fit the current dimensions of the widget.
+ * * The stage is already scaled to the widget, so this is a plain blit.
  */
 void MainFlower::paintEvent(QPaintEvent *)
 {
+    if(activeVisual.isNull() || activeVisual.size() != size() * devicePixelRatioF()) {
+        activeVisual = scaledStage(leafCount);
+    }
+
     QPainter painter(this);
     if(!activeVisual.isNull()) {
-        // Draw the visual to fill the entire widget rectangle
-        painter.drawPixmap(this->rect(), activeVisual);
+        painter.drawPixmap(0, 0, activeVisual);
     }
 }
@@ -11,6 +11,7 @@
 #include <QWidget>
 #include <QPixmap>
 #include <QMap>
+#include <QTimer>
 
 /**
  * @class MainFlower
@@ -18,6 +19,11 @@
  * * The MainFlower class inherits from QWidget and provides a specialized
  * interface for displaying different flower visuals (stages). It uses
  * a mapping system to associate specific leaf counts with visual assets.
+ * 
+ * Every stage is decoded once and kept pre-scaled to the widget's size in
+ * device pixels, so changing the leaf count only swaps the active pixmap
+ * and painting is a plain blit. Stages are re-scaled only after a resize
+ * or a device-pixel-ratio change.
  */
 class MainFlower : public QWidget
 {
@@ -43,6 +49,14 @@ protected:
      */
     void paintEvent(QPaintEvent *event) override;
 
+    /**
+     * @brief Invalidates the scaled stages when the widget is resized.
+     * @param event The resize event.
+     * * The active stage is re-scaled on the next paint; the others once
+     * resizing has settled.
+     */
+    void resizeEvent(QResizeEvent *event) override;
+
 private:
     /**
      * @brief Loads the flower growth stage images from resources.
@@ -51,9 +65,33 @@ private:
      */
     void loadImages();
 
+    /**
+     * @brief Returns a stage scaled to the current widget size, scaling it if needed.
+     * @param stage The stage (leaf count) to fetch.
+     * @return The scaled pixmap, or a null pixmap if the stage is missing.
+     */
+    QPixmap scaledStage(int stage);
+
+    /**
+     * @brief Scales every stage to the current widget size.
+     */
+    void rescaleStages();
+
     /** @brief A map linking specific leaf counts (int) to their respective image (QPixmap). */
     QMap<int, QPixmap> flowerStages;
 
+    /** @brief The stages scaled to the widget size in device pixels, keyed by leaf count. */
+    QMap<int, QPixmap> scaledStages;
+
+    /** @brief The logical size the scaled stages were made for. */
+    QSize scaledSize;
+
+    /** @brief The device pixel ratio the scaled stages were made for. */
+    qreal scaledRatio;
+
+    /** @brief Delays re-scaling the inactive stages until resizing settles. */
+    QTimer rescaleTimer;
+
     /** @brief The pixmap currently selected for rendering on the screen. */
     QPixmap activeVisual;
 
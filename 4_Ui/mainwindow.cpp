@@ -16,6 +16,8 @@
 #include <QFont>
 #include <QGridLayout>
 #include <QString>
+#include <QFile>
+#include "4_Ui/LeaderboardDelegate.h"
 
 /**
  * @brief Constructor for MainWindow.
@@ -24,11 +26,24 @@
 MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent) {
     playerRepo = new PlayerRepository();
     playerManager = new PlayerManager(playerRepo);
-    stateRepo = new GameStateRepository();
-    wordRepo = new WordRepositoryFile("words.txt");
+    stateRepo = new GameStateRepository(QCoreApplication::applicationDirPath() + "/history");
+    // Prefer the compiled dictionary image when one has been built and is intact
+    wordRepo = nullptr;
+    if (QFile::exists("words.wgd")) {
+        WordRepositoryBinary* image = new WordRepositoryBinary("words.wgd");
+        if (image->isValid()) wordRepo = image;
+        else delete image;
+    }
+    if (!wordRepo)
+        wordRepo = new WordRepositoryFile("words.txt");
+    playerStore = new PlayerStore(QCoreApplication::applicationDirPath() + "/players.db",
+                                  QCoreApplication::applicationDirPath() + "/players.journal",
+                                  QCoreApplication::applicationDirPath() + "/settings.ini",
+                                  playerRepo, wordRepo);
     wordManager = new WordManager(wordRepo);
     gameManager = new GameStateManager(stateRepo, wordManager);
     highScoreManager = new HighScoreManager(playerRepo);
+    imageCache = new ImageCache();
 
     setWindowTitle("WORDGARDEN");
     resize(1536, 1024);
@@ -43,9 +58,12 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent) {
 
     setupUI();
     playerRepo->clear();
-    loadPlayers();
-    connect(qApp, &QCoreApplication::aboutToQuit,
-            this, &MainWindow::saveData);
+    playerStore->loadAll();
+    connect(qApp, &QCoreApplication::aboutToQuit, this, [this]() {
+        gameManager->saveCurrentGame();
+        saveData();
+        playerStore->flush();
+    });
 }
 
 /**
@@ -56,12 +74,15 @@ void MainWindow::setupUI() {
     stackedWidget = new QStackedWidget(this);
     setCentralWidget(stackedWidget);
 
+    // Page backgrounds are decoded at the window size, not the file size
+    const QSize backgroundSize(1536, 1024);
+
     // --- PAGE 1: LOGIN ---
     QWidget *loginPage = new QWidget();
 
     // Background Image
     QLabel *loginBg = new QLabel(loginPage);
-    loginBg->setPixmap(QPixmap(":/6_Images/Backgrounds/login_bg.png"));
+    loginBg->setPixmap(imageCache->pixmap(":/6_Images/Backgrounds/login_bg.png", backgroundSize, devicePixelRatioF()));
     loginBg->setScaledContents(true);
     loginBg->setGeometry(0, 0, 1536, 1024);
     loginBg->lower();
@@ -80,6 +101,14 @@ void MainWindow::setupUI() {
                              "border: 2px solid #3498db; border-radius: 8px; padding: 5px;");
     loginLayout->addWidget(nameInput, 0, Qt::AlignCenter);
 
+    // Returning players get name suggestions from the repository's name index
+    nameSuggestions = new QStringListModel(this);
+    QCompleter *nameCompleter = new QCompleter(nameSuggestions, this);
+    nameCompleter->setCompletionMode(QCompleter::UnfilteredPopupCompletion);
+    nameCompleter->setCaseSensitivity(Qt::CaseInsensitive);
+    nameInput->setCompleter(nameCompleter);
+    connect(nameInput, &QLineEdit::textEdited, this, &MainWindow::updateNameSuggestions);
+
     loginLayout->addSpacing(20);
 
     // User mode radio buttons
@@ -120,7 +149,8 @@ void MainWindow::setupUI() {
         QToolButton *tb = new QToolButton();
         tb->setCheckable(true);
         tb->setFixedSize(110, 110);
-        tb->setIcon(QIcon(QString(":/6_Images/Avatars/avatar%1.png").arg(i+1)));
+        tb->setIcon(imageCache->icon(QString(":/6_Images/Avatars/avatar%1.png").arg(i+1),
+                                     QSize(110, 110), devicePixelRatioF()));
         tb->setIconSize(QSize(110, 110));
         tb->setStyleSheet("QToolButton { border: 2px solid transparent; border-radius: 55px; background: transparent; }"
                           "QToolButton:checked { border: 5px solid #3498db; background: rgba(52, 152, 219, 25); }");
@@ -144,7 +174,7 @@ void MainWindow::setupUI() {
     QWidget *catPage = new QWidget();
 
     QLabel *catBg = new QLabel(catPage);
-    catBg->setPixmap(QPixmap(":/6_Images/Backgrounds/category_bg.png"));
+    catBg->setPixmap(imageCache->pixmap(":/6_Images/Backgrounds/category_bg.png", backgroundSize, devicePixelRatioF()));
     catBg->setScaledContents(true);
     catBg->setGeometry(0, 0, 1536, 1024);
     catBg->lower();
@@ -193,13 +223,14 @@ void MainWindow::setupUI() {
         QString name = getCategoryName(currentCat);
         int guessedCount = 0;
         if (currentPlayer) {
-            guessedCount = currentPlayer->getCompletedWords(currentCat).size();
+            guessedCount = currentPlayer->getCategoryProgress(currentCat);
         }
         int totalWords = 10;
 
         QString btnText = QString("%1\n%2/%3 COMPLETED").arg(name).arg(guessedCount).arg(totalWords);
         QPushButton *b = new QPushButton(btnText);
-        b->setIcon(QIcon(QString(":/6_Images/Icons/icon%1.png").arg(i + 1)));
+        b->setIcon(imageCache->icon(QString(":/6_Images/Icons/icon%1.png").arg(i + 1),
+                                    QSize(85, 85), devicePixelRatioF()));
         b->setIconSize(QSize(85, 85));
         b->setFixedSize(400, 150);
 
@@ -321,7 +352,7 @@ void MainWindow::setupUI() {
     QWidget *scorePage = new QWidget();
 
     QLabel *scoreBg = new QLabel(scorePage);
-    scoreBg->setPixmap(QPixmap(":/6_Images/Backgrounds/category_bg.png"));
+    scoreBg->setPixmap(imageCache->pixmap(":/6_Images/Backgrounds/category_bg.png", backgroundSize, devicePixelRatioF()));
     scoreBg->setScaledContents(true);
     scoreBg->setGeometry(0, 0, 1536, 1024);
     scoreBg->lower();
@@ -385,11 +416,37 @@ void MainWindow::setupUI() {
 
     scoreLayout->addWidget(currentUserPanel);
 
-    // Leaderboard Table initialization
-    scoreTable = new QTableWidget(0, 3, this);
-    scoreTable->setHorizontalHeaderLabels({"Avatar", "Name", "Score"});
+    // Board filters: period and category, each backed by its own ranked index
+    QHBoxLayout *filterLayout = new QHBoxLayout();
+    const QString comboStyle = "QComboBox { font-size: 16px; font-weight: bold; padding: 6px 12px; "
+                               "border: 2px solid #3498db; border-radius: 8px; background: white; }";
+    periodCombo = new QComboBox();
+    periodCombo->addItems({"TODAY", "THIS WEEK", "ALL TIME"});
+    periodCombo->setCurrentIndex(static_cast<int>(LeaderboardPeriod::AllTime));
+    periodCombo->setStyleSheet(comboStyle);
+
+    boardCategoryCombo = new QComboBox();
+    boardCategoryCombo->addItem("ALL CATEGORIES");
+    for (int i = 0; i < 6; ++i) {
+        boardCategoryCombo->addItem(getCategoryName(static_cast<CategoryEnum>(i)).toUpper());
+    }
+    boardCategoryCombo->setStyleSheet(comboStyle);
+
+    filterLayout->addStretch();
+    filterLayout->addWidget(periodCombo);
+    filterLayout->addWidget(boardCategoryCombo);
+    scoreLayout->addLayout(filterLayout);
+    connect(periodCombo, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &MainWindow::updateScoreTable);
+    connect(boardCategoryCombo, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &MainWindow::updateScoreTable);
+
+    // Leaderboard Table initialization: rows are painted on demand from the model
+    leaderboardModel = new LeaderboardModel(this);
+    playerRepo->addEventListener(leaderboardModel);
+    scoreTable = new QTableView(this);
+    scoreTable->setModel(leaderboardModel);
+    scoreTable->setItemDelegate(new LeaderboardDelegate(imageCache, scoreTable));
     scoreTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
-    scoreTable->setIconSize(QSize(100, 100));
+    scoreTable->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
     scoreTable->verticalHeader()->setDefaultSectionSize(135);
     scoreTable->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
     scoreTable->horizontalHeader()->setSectionsClickable(false);
@@ -397,7 +454,7 @@ void MainWindow::setupUI() {
     scoreTable->setFocusPolicy(Qt::NoFocus);
 
     scoreTable->setStyleSheet(
-        "QTableWidget {"
+        "QTableView {"
         "   background-color: rgba(255, 255, 255, 200);"
         "   color: #2c3e50;"
         "   border: 3px solid #3498db;"
@@ -459,12 +516,16 @@ void MainWindow::handleLogin() {
             QMessageBox::warning(this, "Error", "Player not found!");
             return;
         }
+        // Only a summary was loaded at startup; read the rest now
+        playerStore->loadProfile(currentPlayer);
         currentPlayer->checkAndUpgradeLevel();
     }
+    wordManager->setPlayer(currentPlayer->getName().toStdString());
+    gameManager->setPlayer(currentPlayer->getName());
 
     int avatarId = currentPlayer->getAvatarId();
     QString avatarPath = QString(":/6_Images/Avatars/avatar%1.png").arg(avatarId + 1);
-    playerAvatarLabel->setPixmap(QPixmap(avatarPath).scaled(120, 120, Qt::KeepAspectRatio, Qt::SmoothTransformation));
+    playerAvatarLabel->setPixmap(imageCache->pixmap(avatarPath, QSize(120, 120), devicePixelRatioF()));
 
     stackedWidget->setCurrentIndex(1);
     updateCategoryProgress();
@@ -479,17 +540,17 @@ void MainWindow::processLetter() {
 
     QChar L = btn->text()[0];
     btn->setEnabled(false);
-    Word* currentWordPtr = wordManager->getCurrentWord();
-    if(!currentWordPtr) return;
+    GuessSession* session = wordManager->getCurrentSession();
+    if(!session) return;
 
     bool correct = wordManager->makeGuess(L.toLatin1());
 
     if(correct) {
         btn->setStyleSheet("background-color: #2ecc71; color: white; font-size: 20px; font-weight: bold;");
-        currentPlayer->increaseScoreForCorrectGuess();
+        currentPlayer->increaseScoreForCorrectGuess(session->getCategory());
     } else {
         btn->setStyleSheet("background-color: #e74c3c; color: white; font-size: 20px; font-weight: bold;");
-        currentPlayer->decreaseScoreForIncorrectGuess();
+        currentPlayer->decreaseScoreForIncorrectGuess(session->getCategory());
 
         GameState* gs = gameManager->getCurrentGameState();
         if(gs) {
@@ -501,20 +562,20 @@ void MainWindow::processLetter() {
     GameState* gs = gameManager->getCurrentGameState();
 
     if(gs && gs->isGameOver()) {
-        CategoryEnum currentCatEnum = currentWordPtr->getCategory();
+        CategoryEnum currentCatEnum = session->getCategory();
         QString currentCatName = getCategoryName(currentCatEnum);
 
-        if(currentWordPtr->isGuessed()) {
-            QString wordStr = QString::fromStdString(currentWordPtr->getWord());
-            currentPlayer->addCompletedWord(currentCatEnum, wordStr);
+        if(session->isGuessed()) {
+            currentPlayer->addCompletedWord(currentCatEnum, wordManager->getCurrentPosition());
             currentPlayer->checkAndUpgradeLevel();
             wordManager->onGameWon();
         }
+        gameManager->saveCurrentGame();
 
         updateCategoryProgress();
 
         QTimer::singleShot(2000, this, [this, currentCatEnum, currentCatName]() {
-            int completed = currentPlayer->getCompletedWords(currentCatEnum).size();
+            int completed = currentPlayer->getCategoryProgress(currentCatEnum);
             int totalWords = 10;
 
             if(completed >= totalWords) {
@@ -529,6 +590,9 @@ void MainWindow::processLetter() {
     if(mainFlower && gs) {
         mainFlower->setLeafCount(gs->getRemainingGuesses());
     }
+
+    // The guess is already journalled; fold the journal into the database now and then
+    playerStore->checkpointIfDue();
 }
 
 /**
@@ -538,8 +602,8 @@ void MainWindow::updateGameUI() {
     GameState* gs = gameManager->getCurrentGameState();
     if(!gs) return;
 
-    QString masked = QString::fromStdString(wordManager->getMaskedWord());
-    wordDisplay->setText(masked.split("").join(" "));
+    hiddenWord = wordManager->getMaskedDisplayText();
+    wordDisplay->setText(hiddenWord);
     statusLabel->setText(QString("SCORE: %1 | MISSES: %2")
                              .arg(currentPlayer->getScore())
                              .arg(gs->getRemainingGuesses()));
@@ -553,66 +617,34 @@ void MainWindow::updateScoreTable() {
 
     // 1. HEADER PANEL UPDATE
     int avId = currentPlayer->getAvatarId();
-    userAvatarLabel->setPixmap(QPixmap(QString(":/6_Images/Avatars/avatar%1.png").arg(avId + 1)));
+    userAvatarLabel->setPixmap(imageCache->pixmap(QString(":/6_Images/Avatars/avatar%1.png").arg(avId + 1),
+                                                  QSize(75, 75), devicePixelRatioF()));
 
     if (userLevelLabel) {
         userLevelLabel->setText(currentPlayer->getLevel());
     }
 
-    userNameLabel->setText(currentPlayer->getName());
-    userScoreLabel->setText("SCORE: " + QString::number(currentPlayer->getScore()));
-
-    // 2. TABLE DATA POPULATION
-    int totalPlayerCount = playerRepo->getAllPlayers().size();
-    QList<Player*> players = highScoreManager->getHighScores(totalPlayerCount);
-
-    scoreTable->setRowCount(0);
-    scoreTable->setSortingEnabled(false);
-
-    for(Player* p : players) {
-        int r = scoreTable->rowCount();
-        scoreTable->insertRow(r);
-
-        // Column 0: Avatar & Level
-        QWidget* avatarContainer = new QWidget();
-        avatarContainer->setStyleSheet("background: transparent; border: none;");
-        QVBoxLayout* vLayout = new QVBoxLayout(avatarContainer);
-        vLayout->setContentsMargins(0, 5, 0, 5);
-
-        QLabel *img = new QLabel();
-        img->setPixmap(QIcon(QString(":/6_Images/Avatars/avatar%1.png").arg(p->getAvatarId() + 1)).pixmap(65, 65));
-        img->setAlignment(Qt::AlignCenter);
-        vLayout->addWidget(img);
-
-        QLabel* levelLabel = new QLabel(p->getLevel());
-        levelLabel->setStyleSheet("font-size: 11pt; color: #7f8c8d; font-weight: bold; border: none;");
-        levelLabel->setAlignment(Qt::AlignCenter);
-        vLayout->addWidget(levelLabel);
-        scoreTable->setCellWidget(r, 0, avatarContainer);
-
-        // Column 1: Name highlight
-        QTableWidgetItem* nameItem = new QTableWidgetItem(p->getName());
-        nameItem->setTextAlignment(Qt::AlignCenter);
-        if(p->getName() == currentPlayer->getName()) {
-            nameItem->setForeground(QBrush(QColor("#3498db")));
-            QFont font = nameItem->font();
-            font.setBold(true);
-            nameItem->setFont(font);
-        }
-        scoreTable->setItem(r, 1, nameItem);
-
-        // Column 2: Score
-        QTableWidgetItem* scoreItem = new QTableWidgetItem();
-        scoreItem->setData(Qt::EditRole, p->getScore());
-        scoreItem->setTextAlignment(Qt::AlignCenter);
-        if(p->getName() == currentPlayer->getName()) {
-            scoreItem->setForeground(QBrush(QColor("#3498db")));
-        }
-        scoreTable->setItem(r, 2, scoreItem);
-    }
+    // Selected board: a period over all categories, or a period in one category
+    const LeaderboardPeriod period = static_cast<LeaderboardPeriod>(periodCombo->currentIndex());
+    const int categoryIndex = boardCategoryCombo->currentIndex() - 1;
+    const CategoryEnum category = static_cast<CategoryEnum>(qMax(categoryIndex, 0));
+    const bool allCategories = categoryIndex < 0;
+
+    int rank = allCategories ? highScoreManager->getRank(currentPlayer, period)
+                             : highScoreManager->getRank(currentPlayer, period, category);
+    int boardScore = allCategories ? highScoreManager->getScore(currentPlayer, period)
+                                   : highScoreManager->getScore(currentPlayer, period, category);
 
-    scoreTable->setSortingEnabled(true);
-    scoreTable->sortItems(2, Qt::DescendingOrder);
+    userNameLabel->setText(currentPlayer->getName());
+    userScoreLabel->setText(QString("SCORE: %1  |  RANK %2")
+                                .arg(boardScore)
+                                .arg(rank > 0 ? "#" + QString::number(rank) : QString("-")));
+
+    // 2. TABLE DATA: the model reads the board's ranking in place, the view paints visible rows only
+    const ScoreWindow* window = allCategories ? highScoreManager->getWindow(period)
+                                              : highScoreManager->getWindow(period, category);
+    leaderboardModel->setBoard(window ? &window->getRanking() : &playerRepo->getRanking(), window);
+    leaderboardModel->setCurrentPlayer(currentPlayer);
 }
 
 /**
@@ -622,7 +654,7 @@ void MainWindow::updateCategoryProgress() {
     for (int i = 0; i < 6; ++i) {
         CategoryEnum cat = static_cast<CategoryEnum>(i);
         QPushButton* b = categoryButtons[i];
-        int completed = currentPlayer ? currentPlayer->getCompletedWords(cat).size() : 0;
+        int completed = currentPlayer ? currentPlayer->getCategoryProgress(cat) : 0;
         int totalWords = 10;
         QString name = getCategoryName(cat);
         b->setText(QString("%1\n%2/%3 COMPLETED").arg(name).arg(completed).arg(totalWords));
@@ -665,102 +697,12 @@ void MainWindow::updateCategoryProgress() {
 }
 
 /**
- * @brief Loads player list and attributes from settings.
- */
-void MainWindow::loadPlayers() {
-    QString path = QCoreApplication::applicationDirPath() + "/settings.ini";
-    QSettings settings(path, QSettings::IniFormat);
-    settings.beginGroup("Players");
-
-    QStringList playerNames = settings.childGroups();
-    for (const QString &name : playerNames) {
-        settings.beginGroup(name);
-        int levelValue = settings.value("level", 0).toInt();
-        PlayerLevel savedLevel = static_cast<PlayerLevel>(levelValue);
-
-        Player* p = new Player(name, savedLevel);
-        p->setScore(settings.value("score", 0).toInt());
-        p->setAvatarId(settings.value("avatar", 0).toInt());
-
-        settings.beginGroup("CompletedWords");
-        for (int i = 0; i < 6; ++i) {
-            CategoryEnum cat = static_cast<CategoryEnum>(i);
-            QStringList words = settings.value(QString::number(i)).toStringList();
-            for (const QString& w : words) {
-                p->addCompletedWord(cat, w);
-            }
-        }
-        settings.endGroup();
-        playerRepo->addPlayer(p);
-        settings.endGroup();
-    }
-    settings.endGroup();
-}
-
-/**
- * @brief Syncs a specific player's full profile.
- */
-void MainWindow::loadCurrentPlayer(const QString& playerName) {
-    Player* p = playerRepo->getPlayerByName(playerName);
-    if (!p) return;
-
-    currentPlayer = p;
-
-    QString path = QCoreApplication::applicationDirPath() + "/settings.ini";
-    QSettings settings(path, QSettings::IniFormat);
-    settings.beginGroup("Players");
-    settings.beginGroup(playerName);
-
-    currentPlayer->setScore(settings.value("score", 0).toInt());
-    currentPlayer->setLevel(static_cast<PlayerLevel>(settings.value("level", 0).toInt()));
-    currentPlayer->setAvatarId(settings.value("avatar", 0).toInt());
-    currentPlayer->setLastGameTime(settings.value("lastTime", 0).toInt());
-
-    settings.beginGroup("CompletedWords");
-    for (int i = 0; i < 6; ++i) {
-        CategoryEnum cat = static_cast<CategoryEnum>(i);
-        QStringList words = settings.value(QString::number(i), QStringList()).toStringList();
-        for (const QString& w : words) {
-            currentPlayer->addCompletedWord(cat, w);
-        }
-    }
-
-    settings.endGroup();
-    settings.endGroup();
-    settings.endGroup();
-    updateCategoryProgress();
-}
-
-/**
- * @brief Saves current player data to persistence layer.
+ * @brief Hands changed player data to the store's background writer.
+ * Only players and fields that changed since the last save are copied;
+ * the disk write happens off the UI thread.
  */
 void MainWindow::saveData() {
-    QString path = QCoreApplication::applicationDirPath() + "/settings.ini";
-    QSettings settings(path, QSettings::IniFormat);
-
-    settings.beginGroup("Players");
-    QList<Player*> players = playerRepo->getAllPlayers();
-
-    for (Player* p : players) {
-        settings.beginGroup(p->getName());
-        settings.setValue("level", static_cast<int>(p->getLevelEnum()));
-        settings.setValue("score", p->getScore());
-        settings.setValue("avatar", p->getAvatarId());
-
-        settings.remove("CompletedWords");
-        settings.beginGroup("CompletedWords");
-        for (int i = 0; i < 6; ++i) {
-            CategoryEnum cat = static_cast<CategoryEnum>(i);
-            QStringList words = p->getCompletedWords(cat);
-            if (!words.isEmpty()) {
-                settings.setValue(QString::number(i), words);
-            }
-        }
-        settings.endGroup();
-        settings.endGroup();
-    }
-    settings.endGroup();
-    settings.sync();
+    playerStore->saveChanges();
 }
 
 /**
@@ -785,7 +727,7 @@ void MainWindow::startNewGame(QString category) {
  * @brief Moves to the next word in the category if available.
  */
 void MainWindow::startNextWordInCategory(CategoryEnum category) {
-    int completed = currentPlayer->getCompletedWords(category).size();
+    int completed = currentPlayer->getCategoryProgress(category);
     int totalWords = 10;
 
     if(completed >= totalWords) {
@@ -815,15 +757,40 @@ void MainWindow::backToCategoryMenu() { updateCategoryProgress(); stackedWidget-
 void MainWindow::toggleUserMode() {
     bool isNewUser = newUserRadio->isChecked();
     avatarSection->setVisible(isNewUser);
+    updateNameSuggestions(nameInput->text());
+}
+
+/**
+ * @brief Refreshes the login suggestions for the typed name.
+ * Only returning players get suggestions. The lookup walks the repository's
+ * name radix tree, so its cost depends on the prefix and the number of
+ * suggestions, not on the number of players.
+ */
+void MainWindow::updateNameSuggestions(const QString& text) {
+    QStringList names;
+    if (oldUserRadio->isChecked()) {
+        for (const Player* p : playerRepo->findPlayersByPrefix(text, MaxNameSuggestions)) {
+            names.append(p->getName());
+        }
+    }
+    nameSuggestions->setStringList(names);
+    if (!names.isEmpty()) {
+        nameInput->completer()->complete();
+    }
 }
 
 /** @brief Executes logout and session cleanup. */
 void MainWindow::logout() {
     nameInput->clear();
+    gameManager->saveCurrentGame();
     if(currentPlayer) saveData();
     stackedWidget->setCurrentIndex(0);
 }
 
-/** @brief Destructor for MainWindow. */
-MainWindow::~MainWindow() {}
+/** @brief Destructor for MainWindow. Waits for pending player saves and word file compaction. */
+MainWindow::~MainWindow() {
+    playerRepo->removeEventListener(leaderboardModel);
+    delete playerStore;
+    delete wordRepo;
+}
 
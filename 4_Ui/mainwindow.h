@@ -11,26 +11,31 @@
 #include <QMainWindow>
 #include <QStackedWidget>
 #include <QLineEdit>
+#include <QCompleter>
+#include <QStringListModel>
 #include <QLabel>
-#include <QTableWidget>
+#include <QTableView>
+#include <QComboBox>
 #include <QPushButton>
 #include <QRadioButton>
 #include <QButtonGroup>
 #include <QGridLayout>
-#include <QSettings>
 #include <QHeaderView>
 #include <QTimer>
 #include <QList>
-#include <QTableWidgetItem>
 #include <QVBoxLayout>
 
 #include "2_Repository/WordRepositoryFile.h"
+#include "2_Repository/WordRepositoryBinary.h"
 #include "3_Manager/WordManager.h"
 #include "3_Manager/GameStateManager.h"
 #include "3_Manager/PlayerManager.h"
 #include "0_Enums/CategoryEnum.h"
 #include "4_Ui/mainFlower.h"
+#include "4_Ui/ImageCache.h"
+#include "4_Ui/LeaderboardModel.h"
 #include "3_Manager/HighScoreManager.h"
+#include "2_Repository/PlayerStore.h"
 
 /**
  * @class MainWindow
@@ -78,16 +83,13 @@ private slots:
     /** @brief Toggles UI elements based on New User or Returning User selection. */
     void toggleUserMode();
 
+    /** @brief Updates the login name suggestions for the typed prefix. */
+    void updateNameSuggestions(const QString& text);
+
 private:
     /** @brief Initializes all UI components and the QStackedWidget. */
     void setupUI();
 
-    /** @brief Loads the list of registered players from the repository. */
-    void loadPlayers();
-
-    /** @brief Loads data for a specific player by name. */
-    void loadCurrentPlayer(const QString& playerName);
-
     /** @brief Refreshes the gameplay UI (word display, attempts, flower stage). */
     void updateGameUI();
 
@@ -97,7 +99,7 @@ private:
     /** @brief Resets all alphabet buttons to their enabled/initial state. */
     void resetAlphabetButtons();
 
-    /** @brief Persists player and game progress to storage. */
+    /** @brief Queues changed player data for the background writer. */
     void saveData();
 
     /** @brief Updates progress tracking for the active category. */
@@ -117,6 +119,8 @@ private:
 
     // Login Screen Components
     QLineEdit *nameInput;
+    QStringListModel *nameSuggestions;         ///< Player names offered by the login completer.
+    static constexpr int MaxNameSuggestions = 8; ///< Rows shown in the suggestion popup.
     QRadioButton *newUserRadio, *oldUserRadio;
     QWidget *avatarSection;
     QButtonGroup *avatarGroup;
@@ -126,7 +130,10 @@ private:
     QLabel *userLevelLabel; ///< Displays the player's current level/rank.
 
     // Collection Components
-    QTableWidget *scoreTable;
+    QTableView *scoreTable;
+    LeaderboardModel *leaderboardModel; ///< Ranked players shown by scoreTable.
+    QComboBox *periodCombo;             ///< Leaderboard period (today, this week, all time).
+    QComboBox *boardCategoryCombo;      ///< Leaderboard category; index 0 means all categories.
     QList<QPushButton*> alphabetButtons;
     QList<QPushButton*> categoryButtons;
 
@@ -147,12 +154,14 @@ private:
 
     // Manager and Repository Pointers
     PlayerRepository* playerRepo;      ///< Repository for player persistence.
+    PlayerStore* playerStore;          ///< Loads players and writes their changes in the background.
     PlayerManager* playerManager;      ///< Logic for player-related operations.
     IWordRepository* wordRepo;         ///< Repository for word data.
     WordManager* wordManager;          ///< Logic for word selection and validation.
     GameStateManager* gameManager;     ///< Logic for managing active game sessions.
     GameStateRepository* stateRepo;    ///< Repository for saving/loading game states.
     HighScoreManager* highScoreManager;///< Logic for ranking and scores.
+    ImageCache* imageCache;            ///< Display-size decoded images shared by all screens.
     MainFlower* mainFlower;            ///< Custom widget for visual growth feedback.
 };
 
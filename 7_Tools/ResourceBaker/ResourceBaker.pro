@@ -0,0 +1,12 @@
+QT       += core gui
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = ResourceBaker
+
+SOURCES += \
+    main.cpp
+
+DISTFILES += \
+    ../../6_Images/images.manifest
@@ -0,0 +1,178 @@
+/**
+ * @file main.cpp
+ * @brief Command-line entry point of the build-time image baker.
+ *
+ * Reads 6_Images/images.manifest, scales every listed image down to the
+ * size the UI actually draws it at (@1x) and to twice that size (@2x),
+ * re-encodes it and writes a resources_baked.qrc that maps the original
+ * resource paths to the baked files. The game code keeps using the same
+ * ":/6_Images/..." paths; only the bundle behind them shrinks.
+ *
+ * Usage: ResourceBaker <source root> <images.manifest> <output dir>
+ */
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QImage>
+#include <QImageReader>
+#include <QList>
+#include <QPair>
+#include <QSize>
+#include <QStringList>
+#include <QTextStream>
+
+/**
+ * @struct BakeItem
+ * @brief One manifest line: an image and the size it is displayed at.
+ */
+struct BakeItem {
+    QString resourcePath;   ///< Path as listed in resources.qrc
+    QSize displaySize;      ///< Largest logical size the UI draws it at
+    QString format;         ///< Output format ("png" or "jpg")
+};
+
+/**
+ * @brief Parses the manifest.
+ * @param path Manifest file path.
+ * @param items Receives the parsed entries.
+ * @return true on success, false if the file is unreadable or malformed.
+ */
+static bool readManifest(const QString& path, QList<BakeItem>& items)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        QTextStream(stderr) << "Cannot open manifest " << path << "\n";
+        return false;
+    }
+
+    int lineNumber = 0;
+    QTextStream in(&file);
+    while (!in.atEnd()) {
+        lineNumber++;
+        QString line = in.readLine().trimmed();
+        if (line.isEmpty() || line.startsWith('#')) continue;
+
+        QStringList fields = line.split(' ', Qt::SkipEmptyParts);
+        bool okWidth = false, okHeight = false;
+        if (fields.size() == 4) {
+            BakeItem item;
+            item.resourcePath = fields[0];
+            item.displaySize = QSize(fields[1].toInt(&okWidth), fields[2].toInt(&okHeight));
+            item.format = fields[3].toLower();
+            if (okWidth && okHeight && !item.displaySize.isEmpty()
+                && (item.format == "png" || item.format == "jpg")) {
+                items.append(item);
+                continue;
+            }
+        }
+        QTextStream(stderr) << path << ":" << lineNumber << ": malformed entry\n";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Writes one scaled variant of an image unless it is up to date.
+ * @param source Decoded full-size image.
+ * @param sourceInfo Source file, used for the up-to-date check.
+ * @param size Target bounding box in pixels.
+ * @param format Output format.
+ * @param outputPath Destination file.
+ * @return true on success.
+ */
+static bool bakeVariant(const QImage& source, const QFileInfo& sourceInfo, const QSize& size,
+                        const QString& format, const QString& outputPath)
+{
+    QFileInfo outputInfo(outputPath);
+    if (outputInfo.exists() && outputInfo.lastModified() >= sourceInfo.lastModified()) {
+        return true;
+    }
+
+    QImage scaled = source.size() == size
+        ? source
+        : source.scaled(size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    if (format == "jpg") {
+        scaled = scaled.convertToFormat(QImage::Format_RGB32);
+    }
+
+    QDir().mkpath(outputInfo.absolutePath());
+    if (!scaled.save(outputPath, format == "jpg" ? "JPG" : "PNG", format == "jpg" ? 88 : -1)) {
+        QTextStream(stderr) << "Cannot write " << outputPath << "\n";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Bakes every manifest entry and writes the resource bundle.
+ * @param argc Number of command-line arguments.
+ * @param argv Source root, manifest and output directory.
+ * @return 0 on success, 1 on bad usage or any failure.
+ */
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QStringList args = app.arguments();
+
+    if (args.size() != 4) {
+        QTextStream(stderr) << "Usage: ResourceBaker <source root> <images.manifest> <output dir>\n";
+        return 1;
+    }
+
+    const QDir sourceRoot(args[1]);
+    const QDir outputDir(args[3]);
+    QList<BakeItem> items;
+    if (!readManifest(args[2], items)) return 1;
+
+    QString qrc;
+    QTextStream qrcOut(&qrc);
+    qrcOut << "<RCC>\n    <qresource prefix=\"/\">\n";
+
+    for (const BakeItem& item : items) {
+        const QFileInfo sourceInfo(sourceRoot.filePath(item.resourcePath));
+        QImageReader reader(sourceInfo.filePath());
+        QImage source = reader.read();
+        if (source.isNull()) {
+            QTextStream(stderr) << "Cannot read " << sourceInfo.filePath() << ": "
+                                << reader.errorString() << "\n";
+            return 1;
+        }
+
+        // Never upscale: the @1x box is capped at the source size and the
+        // @2x variant is only produced when the source has the pixels for it
+        const QString base = QFileInfo(item.resourcePath).path() + "/"
+                             + QFileInfo(item.resourcePath).completeBaseName();
+        const QString suffix = QFileInfo(item.resourcePath).suffix();
+        QList<QPair<QString, QSize>> variants;
+        variants.append({ "", item.displaySize.boundedTo(source.size()) });
+        if (source.width() >= item.displaySize.width() * 2
+            && source.height() >= item.displaySize.height() * 2) {
+            variants.append({ "@2x", item.displaySize * 2 });
+        }
+
+        for (const auto& variant : variants) {
+            const QString bakedPath = base + variant.first + "." + item.format;
+            if (!bakeVariant(source, sourceInfo, variant.second, item.format,
+                             outputDir.filePath(bakedPath))) {
+                return 1;
+            }
+            // Keep the original resource name so no code path changes
+            qrcOut << "        <file alias=\"" << base << variant.first << "." << suffix << "\">"
+                   << bakedPath << "</file>\n";
+        }
+    }
+
+    qrcOut << "    </qresource>\n</RCC>\n";
+    qrcOut.flush();
+
+    QFile qrcFile(outputDir.filePath("resources_baked.qrc"));
+    if (!qrcFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        QTextStream(stderr) << "Cannot write " << qrcFile.fileName() << "\n";
+        return 1;
+    }
+    qrcFile.write(qrc.toUtf8());
+    QTextStream(stdout) << "Baked " << items.size() << " images into " << outputDir.path() << "\n";
+    return 0;
+}
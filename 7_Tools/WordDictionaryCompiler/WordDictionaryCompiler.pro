@@ -0,0 +1,29 @@
+QT       += core
+QT       -= gui
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = WordDictionaryCompiler
+
+# Sources are shared with the game
+INCLUDEPATH += ../..
+
+SOURCES += \
+    main.cpp \
+    ../../1_Entities/DictionaryEntry.cpp \
+    ../../1_Entities/RandomGenerator.cpp \
+    ../../2_Repository/Crc32c.cpp \
+    ../../2_Repository/StringArena.cpp \
+    ../../2_Repository/WordRepositoryFile.cpp \
+    ../../2_Repository/WordDictionaryCompiler.cpp
+
+HEADERS += \
+    ../../1_Entities/DictionaryEntry.h \
+    ../../1_Entities/RandomGenerator.h \
+    ../../2_Repository/Crc32c.h \
+    ../../2_Repository/IWordRepository.h \
+    ../../2_Repository/StringArena.h \
+    ../../2_Repository/WordRepositoryFile.h \
+    ../../2_Repository/WordDictionaryFormat.h \
+    ../../2_Repository/WordDictionaryCompiler.h
@@ -0,0 +1,34 @@
+/**
+ * @file main.cpp
+ * @brief Command-line entry point of the offline dictionary compiler.
+ * 
+ * Turns a words.txt style dictionary ("word category" per line) into a
+ * compiled .wgd image that WordRepositoryBinary can map at startup.
+ * 
+ * Usage: WordDictionaryCompiler <words.txt> <words.wgd>
+ */
+
+#include "2_Repository/WordRepositoryFile.h"
+#include "2_Repository/WordDictionaryCompiler.h"
+#include <QCoreApplication>
+#include <QTextStream>
+
+/**
+ * @brief Compiles the input dictionary into a binary image.
+ * @param argc Number of command-line arguments.
+ * @param argv Input text file and output image paths.
+ * @return 0 on success, 1 on bad usage or write failure.
+ */
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QStringList args = app.arguments();
+
+    if (args.size() != 3) {
+        QTextStream(stderr) << "Usage: WordDictionaryCompiler <words.txt> <words.wgd>\n";
+        return 1;
+    }
+
+    WordRepositoryFile source(args[1].toStdString());
+    return WordDictionaryCompiler::compile(source, args[2].toStdString()) ? 0 : 1;
+}
@@ -1,4 +1,4 @@
-QT       += core gui
+QT       += core gui sql
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 
@@ -15,32 +15,67 @@ SOURCES += \
     3_Manager/HighScoreManager.cpp \
     1_Entities/Player.cpp \
     3_Manager/PlayerManager.cpp \
+    2_Repository/PlayerJournal.cpp \
+    2_Repository/PlayerNameTrie.cpp \
+    2_Repository/PlayerRanking.cpp \
     2_Repository/PlayerRepository.cpp \
+    2_Repository/PlayerStore.cpp \
     1_Entities/Score.cpp \
-    1_Entities/Word.cpp \
+    2_Repository/ScoreLeaderboards.cpp \
+    2_Repository/ScoreWindow.cpp \
+    2_Repository/Crc32c.cpp \
+    1_Entities/DictionaryEntry.cpp \
+    1_Entities/GuessSession.cpp \
+    1_Entities/RandomGenerator.cpp \
+    1_Entities/WordSampler.cpp \
     3_Manager/WordManager.cpp \
+    2_Repository/StringArena.cpp \
+    2_Repository/WordDictionaryCompiler.cpp \
+    2_Repository/WordRepositoryBinary.cpp \
     2_Repository/WordRepositoryFile.cpp \
     2_Repository/WordRepositoryMemory.cpp \
+    4_Ui/ImageCache.cpp \
+    4_Ui/LeaderboardDelegate.cpp \
+    4_Ui/LeaderboardModel.cpp \
     4_Ui/main.cpp \
     4_Ui/mainFlower.cpp \
     4_Ui/mainwindow.cpp
 
 HEADERS += \
     0_Enums/CategoryEnum.h \
+    0_Enums/GameOutcome.h \
     1_Entities/GameState.h \
     3_Manager/GameStateManager.h \
     2_Repository/GameStateRepository.h \
     3_Manager/HighScoreManager.h \
     2_Repository/IWordRepository.h \
+    0_Enums/LeaderboardPeriod.h \
     1_Entities/Player.h \
     0_Enums/PlayerLevel.h \
     3_Manager/PlayerManager.h \
+    2_Repository/PlayerJournal.h \
+    2_Repository/PlayerNameTrie.h \
+    2_Repository/PlayerRanking.h \
     2_Repository/PlayerRepository.h \
+    2_Repository/PlayerStore.h \
     1_Entities/Score.h \
-    1_Entities/Word.h \
+    2_Repository/ScoreLeaderboards.h \
+    2_Repository/ScoreWindow.h \
+    2_Repository/Crc32c.h \
+    1_Entities/DictionaryEntry.h \
+    1_Entities/GuessSession.h \
+    1_Entities/RandomGenerator.h \
+    1_Entities/WordSampler.h \
     3_Manager/WordManager.h \
+    2_Repository/StringArena.h \
+    2_Repository/WordDictionaryCompiler.h \
+    2_Repository/WordDictionaryFormat.h \
+    2_Repository/WordRepositoryBinary.h \
     2_Repository/WordRepositoryFile.h \
     2_Repository/WordRepositoryMemory.h \
+    4_Ui/ImageCache.h \
+    4_Ui/LeaderboardDelegate.h \
+    4_Ui/LeaderboardModel.h \
     4_Ui/mainFlower.h \
     4_Ui/mainwindow.h
 
@@ -52,8 +87,28 @@ qnx: target.path = /tmp/$${TARGET}/bin
 else: unix:!android: target.path = /opt/$${TARGET}/bin
 !isEmpty(target.path): INSTALLS += target
 
-RESOURCES += \
-    resources.qrc
+# Images are baked to their display size (@1x/@2x) by 7_Tools/ResourceBaker.
+# Run "make bake_assets" once, then re-run qmake to embed the baked bundle;
+# until then the full-size originals from resources.qrc are embedded.
+BAKED_DIR = $$OUT_PWD/baked
+BAKER_BUILD_DIR = $$OUT_PWD/7_Tools/ResourceBaker
+
+bake_assets.commands = \
+    $(MKDIR) $$shell_path($$BAKER_BUILD_DIR) && \
+    cd $$shell_path($$BAKER_BUILD_DIR) && \
+    $$QMAKE_QMAKE $$shell_path($$PWD/7_Tools/ResourceBaker/ResourceBaker.pro) && \
+    $(MAKE) && \
+    $$shell_path(./ResourceBaker) $$shell_path($$PWD) \
+        $$shell_path($$PWD/6_Images/images.manifest) $$shell_path($$BAKED_DIR)
+QMAKE_EXTRA_TARGETS += bake_assets
+
+exists($$BAKED_DIR/resources_baked.qrc) {
+    RESOURCES += $$BAKED_DIR/resources_baked.qrc
+} else {
+    RESOURCES += \
+        resources.qrc
+}
 
 DISTFILES += \
-    5_File/words.txt
+    5_File/words.txt \
+    6_Images/images.manifest